@@ -575,10 +575,10 @@ LinkerObject const& Assembly::assemble() const
 
 	size_t bytesRequiredForCode = bytesRequired(subTagSize);
 	m_tagPositionsInBytecode = vector<size_t>(m_usedTags, numeric_limits<size_t>::max());
-	map<size_t, pair<size_t, size_t>> tagRef;
-	multimap<h256, unsigned> dataRef;
-	multimap<size_t, size_t> subRef;
-	vector<unsigned> sizeRef; ///< Pointers to code locations where the size of the program is inserted
+	vector<pair<size_t, pair<size_t, size_t>>> tagRef; ///< Code locations of tag references with sub id and tag id
+	vector<pair<h256, size_t>> dataRef;
+	vector<pair<size_t, size_t>> subRef;
+	vector<size_t> sizeRef; ///< Pointers to code locations where the size of the program is inserted
 	unsigned bytesPerTag = util::bytesRequired(bytesRequiredForCode);
 	uint8_t tagPush = (uint8_t)Instruction::PUSH1 - 1 + bytesPerTag;
 
@@ -626,19 +626,19 @@ LinkerObject const& Assembly::assemble() const
 		case PushTag:
 		{
 			ret.bytecode.push_back(tagPush);
-			tagRef[ret.bytecode.size()] = i.splitForeignPushTag();
+			tagRef.emplace_back(ret.bytecode.size(), i.splitForeignPushTag());
 			ret.bytecode.resize(ret.bytecode.size() + bytesPerTag);
 			break;
 		}
 		case PushData:
 			ret.bytecode.push_back(dataRefPush);
-			dataRef.insert(make_pair((h256)i.data(), ret.bytecode.size()));
+			dataRef.emplace_back((h256)i.data(), ret.bytecode.size());
 			ret.bytecode.resize(ret.bytecode.size() + bytesPerDataRef);
 			break;
 		case PushSub:
 			assertThrow(i.data() <= numeric_limits<size_t>::max(), AssemblyException, "");
 			ret.bytecode.push_back(dataRefPush);
-			subRef.insert(make_pair(static_cast<size_t>(i.data()), ret.bytecode.size()));
+			subRef.emplace_back(static_cast<size_t>(i.data()), ret.bytecode.size());
 			ret.bytecode.resize(ret.bytecode.size() + bytesPerDataRef);
 			break;
 		case PushSubSize:
@@ -710,6 +710,9 @@ LinkerObject const& Assembly::assemble() const
 		// Append an INVALID here to help tests find miscompilation.
 		ret.bytecode.push_back(uint8_t(Instruction::INVALID));
 
+	// Sub assemblies are appended in the order of their ids and, for the same id,
+	// in the order of the references.
+	stable_sort(subRef.begin(), subRef.end(), [](auto const& _a, auto const& _b) { return _a.first < _b.first; });
 	for (auto const& [subIdPath, bytecodeOffset]: subRef)
 	{
 		bytesRef r(ret.bytecode.data() + bytecodeOffset, bytesPerDataRef);
@@ -717,11 +720,9 @@ LinkerObject const& Assembly::assemble() const
 		ret.append(subAssemblyById(subIdPath)->assemble());
 	}
 
-	for (auto const& i: tagRef)
+	for (auto const& [tagRefPosition, tagIds]: tagRef)
 	{
-		size_t subId;
-		size_t tagId;
-		tie(subId, tagId) = i.second;
+		auto const& [subId, tagId] = tagIds;
 		assertThrow(subId == numeric_limits<size_t>::max() || subId < m_subs.size(), AssemblyException, "Invalid sub id");
 		vector<size_t> const& tagPositions =
 			subId == numeric_limits<size_t>::max() ?
@@ -731,17 +732,23 @@ LinkerObject const& Assembly::assemble() const
 		size_t pos = tagPositions[tagId];
 		assertThrow(pos != numeric_limits<size_t>::max(), AssemblyException, "Reference to tag without position.");
 		assertThrow(util::bytesRequired(pos) <= bytesPerTag, AssemblyException, "Tag too large for reserved space.");
-		bytesRef r(ret.bytecode.data() + i.first, bytesPerTag);
+		bytesRef r(ret.bytecode.data() + tagRefPosition, bytesPerTag);
 		toBigEndian(pos, r);
 	}
+
+	// Both the data items and (after sorting) the data references are ordered by hash,
+	// so they can be processed in a single pass.
+	sort(dataRef.begin(), dataRef.end());
+	auto dataRefIt = dataRef.begin();
 	for (auto const& dataItem: m_data)
 	{
-		auto references = dataRef.equal_range(dataItem.first);
-		if (references.first == references.second)
+		while (dataRefIt != dataRef.end() && dataRefIt->first < dataItem.first)
+			++dataRefIt;
+		if (dataRefIt == dataRef.end() || dataRefIt->first != dataItem.first)
 			continue;
-		for (auto ref = references.first; ref != references.second; ++ref)
+		for (; dataRefIt != dataRef.end() && dataRefIt->first == dataItem.first; ++dataRefIt)
 		{
-			bytesRef r(ret.bytecode.data() + ref->second, bytesPerDataRef);
+			bytesRef r(ret.bytecode.data() + dataRefIt->second, bytesPerDataRef);
 			toBigEndian(ret.bytecode.size(), r);
 		}
 		ret.bytecode += dataItem.second;
@@ -749,7 +756,7 @@ LinkerObject const& Assembly::assemble() const
 
 	ret.bytecode += m_auxiliaryData;
 
-	for (unsigned pos: sizeRef)
+	for (size_t pos: sizeRef)
 	{
 		bytesRef r(ret.bytecode.data() + pos, bytesPerDataRef);
 		toBigEndian(ret.bytecode.size(), r);
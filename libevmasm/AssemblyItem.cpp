@@ -23,9 +23,12 @@
 #include <libsolutil/CommonData.h>
 #include <libsolutil/StringUtils.h>
 #include <libsolutil/FixedHash.h>
+#include <liblangutil/CharStream.h>
 #include <liblangutil/SourceLocation.h>
 
+#include <charconv>
 #include <fstream>
+#include <unordered_map>
 
 using namespace std;
 using namespace solidity;
@@ -318,50 +321,109 @@ ostream& solidity::evmasm::operator<<(ostream& _out, AssemblyItem const& _item)
 	return _out;
 }
 
+namespace
+{
+
+/// Source mapping components of a single item.
+struct ItemMapping
+{
+	int start = -1;
+	int length = -1;
+	int sourceIndex = -1;
+	char jump = '-';
+	int modifierDepth = -1;
+};
+
+/// Computes the source mapping components of items, looking up the index of each
+/// source only once instead of once per item.
+class ItemMappingComputer
+{
+public:
+	explicit ItemMappingComputer(map<string, unsigned> const& _sourceIndicesMap):
+		m_sourceIndicesMap(_sourceIndicesMap)
+	{}
+
+	ItemMapping operator()(AssemblyItem const& _item, int _modifierDepth)
+	{
+		SourceLocation const& location = _item.location();
+		ItemMapping mapping;
+		mapping.start = location.start;
+		mapping.length = location.start != -1 && location.end != -1 ? location.end - location.start : -1;
+		mapping.sourceIndex = sourceIndex(location.source.get());
+		if (_item.getJumpType() == AssemblyItem::JumpType::IntoFunction)
+			mapping.jump = 'i';
+		else if (_item.getJumpType() == AssemblyItem::JumpType::OutOfFunction)
+			mapping.jump = 'o';
+		mapping.modifierDepth = _modifierDepth;
+		return mapping;
+	}
+
+private:
+	int sourceIndex(CharStream const* _source)
+	{
+		if (!_source)
+			return -1;
+		// Consecutive items usually stem from the same source.
+		if (_source != m_lastSource)
+		{
+			auto [it, inserted] = m_sourceIndices.emplace(_source, -1);
+			if (inserted)
+				if (auto index = m_sourceIndicesMap.find(_source->name()); index != m_sourceIndicesMap.end())
+					it->second = static_cast<int>(index->second);
+			m_lastSource = _source;
+			m_lastSourceIndex = it->second;
+		}
+		return m_lastSourceIndex;
+	}
+
+	map<string, unsigned> const& m_sourceIndicesMap;
+	unordered_map<CharStream const*, int> m_sourceIndices;
+	CharStream const* m_lastSource = nullptr;
+	int m_lastSourceIndex = -1;
+};
+
+void appendNumber(string& _out, int _number)
+{
+	char buffer[16];
+	auto result = to_chars(begin(buffer), end(buffer), _number);
+	_out.append(buffer, result.ptr);
+}
+
+}
+
 std::string AssemblyItem::computeSourceMapping(
 	AssemblyItems const& _items,
 	map<string, unsigned> const& _sourceIndicesMap
 )
 {
 	string ret;
+	// Most items share their location with the previous item and only take one character.
+	ret.reserve(2 * _items.size());
 
-	int prevStart = -1;
-	int prevLength = -1;
-	int prevSourceIndex = -1;
-	int prevModifierDepth = -1;
-	char prevJump = 0;
+	ItemMappingComputer computeMapping(_sourceIndicesMap);
+	ItemMapping prev;
+	prev.jump = 0;
 	for (auto const& item: _items)
 	{
 		if (!ret.empty())
 			ret += ";";
 
-		SourceLocation const& location = item.location();
-		int length = location.start != -1 && location.end != -1 ? location.end - location.start : -1;
-		int sourceIndex =
-			location.source && _sourceIndicesMap.count(location.source->name()) ?
-			static_cast<int>(_sourceIndicesMap.at(location.source->name())) :
-			-1;
-		char jump = '-';
-		if (item.getJumpType() == evmasm::AssemblyItem::JumpType::IntoFunction)
-			jump = 'i';
-		else if (item.getJumpType() == evmasm::AssemblyItem::JumpType::OutOfFunction)
-			jump = 'o';
-		int modifierDepth = static_cast<int>(item.m_modifierDepth);
+		ItemMapping const current = computeMapping(item, static_cast<int>(item.m_modifierDepth));
 
 		unsigned components = 5;
-		if (modifierDepth == prevModifierDepth)
+		if (current.modifierDepth == prev.modifierDepth)
 		{
 			components--;
-			if (jump == prevJump)
+			if (current.jump == prev.jump)
 			{
 				components--;
-				if (sourceIndex == prevSourceIndex)
+				if (current.sourceIndex == prev.sourceIndex)
 				{
 					components--;
-					if (length == prevLength)
+					if (current.length == prev.length)
 					{
 						components--;
-						if (location.start == prevStart)
+						if (current.start == prev.start)
 							components--;
 					}
 				}
@@ -370,39 +432,35 @@ std::string AssemblyItem::computeSourceMapping(
 
 		if (components-- > 0)
 		{
-			if (location.start != prevStart)
-				ret += to_string(location.start);
+			if (current.start != prev.start)
+				appendNumber(ret, current.start);
 			if (components-- > 0)
 			{
 				ret += ':';
-				if (length != prevLength)
-					ret += to_string(length);
+				if (current.length != prev.length)
+					appendNumber(ret, current.length);
 				if (components-- > 0)
 				{
 					ret += ':';
-					if (sourceIndex != prevSourceIndex)
-						ret += to_string(sourceIndex);
+					if (current.sourceIndex != prev.sourceIndex)
+						appendNumber(ret, current.sourceIndex);
 					if (components-- > 0)
 					{
 						ret += ':';
-						if (jump != prevJump)
-							ret += jump;
+						if (current.jump != prev.jump)
+							ret += current.jump;
 						if (components-- > 0)
 						{
 							ret += ':';
-							if (modifierDepth != prevModifierDepth)
-								ret += to_string(modifierDepth);
+							if (current.modifierDepth != prev.modifierDepth)
+								appendNumber(ret, current.modifierDepth);
 						}
 					}
 				}
 			}
 		}
 
-		prevStart = location.start;
-		prevLength = length;
-		prevSourceIndex = sourceIndex;
-		prevJump = jump;
-		prevModifierDepth = modifierDepth;
+		prev = current;
 	}
 	return ret;
 }
@@ -25,6 +25,10 @@
 #include <libevmasm/GasMeter.h>
 #include <libsolutil/CommonData.h>
 
+#include <map>
+#include <mutex>
+#include <tuple>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::evmasm;
@@ -188,6 +192,36 @@ AssemblyItems const& CodeCopyMethod::copyRoutine()
 	return copyRoutine;
 }
 
+ComputeMethod::ComputeMethod(Params const& _params, u256 const& _value):
+	ConstantOptimisationMethod(_params, _value)
+{
+	size_t constexpr maxMemoSize = 4096;
+	static mutex memoMutex;
+	static map<tuple<u256, langutil::EVMVersion, bool, size_t, size_t>, AssemblyItems> memo;
+
+	auto key = make_tuple(m_value, m_params.evmVersion, m_params.isCreation, m_params.runs, m_params.multiplicity);
+	{
+		lock_guard<mutex> lock(memoMutex);
+		if (auto it = memo.find(key); it != memo.end())
+		{
+			m_routine = it->second;
+			return;
+		}
+	}
+
+	m_routine = findRepresentation(m_value);
+	assertThrow(
+		checkRepresentation(m_value, m_routine),
+		OptimizerException,
+		"Invalid constant expression created."
+	);
+
+	lock_guard<mutex> lock(memoMutex);
+	if (memo.size() >= maxMemoSize)
+		memo.clear();
+	memo.emplace(move(key), m_routine);
+}
+
 AssemblyItems ComputeMethod::findRepresentation(u256 const& _value)
 {
 	if (_value < 0x10000)
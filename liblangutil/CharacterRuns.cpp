@@ -0,0 +1,160 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <liblangutil/CharacterRuns.h>
+
+#include <liblangutil/Common.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SOL_CHARACTER_RUNS_SSE2 1
+#include <emmintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::langutil;
+
+namespace
+{
+
+#ifdef SOL_CHARACTER_RUNS_SSE2
+
+size_t constexpr c_blockSize = 16;
+
+unsigned countTrailingZeros(unsigned _mask)
+{
+#ifdef _MSC_VER
+	unsigned long index;
+	_BitScanForward(&index, _mask);
+	return static_cast<unsigned>(index);
+#else
+	return static_cast<unsigned>(__builtin_ctz(_mask));
+#endif
+}
+
+__m128i equal(__m128i _block, char _c)
+{
+	return _mm_cmpeq_epi8(_block, _mm_set1_epi8(_c));
+}
+
+/// @returns a mask of the bytes in @a _block that lie in the range [@a _low, @a _high].
+/// SSE2 only has signed comparisons, so the range is shifted to start at -128 first.
+__m128i inRange(__m128i _block, unsigned char _low, unsigned char _high)
+{
+	__m128i shifted = _mm_add_epi8(_block, _mm_set1_epi8(static_cast<char>(0x80 - _low)));
+	return _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(-128 + (_high - _low) + 1)));
+}
+
+#endif
+
+/// @returns the position of the first character at or after @a _position for which @a _stopsBlock
+/// (on blocks of 16 bytes) or @a _stops (on single characters) is true.
+template <class StopsBlock, class Stops>
+size_t findStop(string const& _text, size_t _position, [[maybe_unused]] StopsBlock _stopsBlock, Stops _stops)
+{
+	char const* data = _text.data();
+	size_t const size = _text.size();
+#ifdef SOL_CHARACTER_RUNS_SSE2
+	for (; _position + c_blockSize <= size; _position += c_blockSize)
+	{
+		__m128i block = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data + _position));
+		unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_stopsBlock(block)));
+		if (mask)
+			return _position + countTrailingZeros(mask);
+	}
+#endif
+	while (_position < size && !_stops(data[_position]))
+		++_position;
+	return _position;
+}
+
+}
+
+#ifdef SOL_CHARACTER_RUNS_SSE2
+#define SOL_BLOCK_PREDICATE(BODY) [&](__m128i _block) { return BODY; }
+#else
+#define SOL_BLOCK_PREDICATE(BODY) nullptr
+#endif
+
+size_t solidity::langutil::skipWhiteSpace(string const& _text, size_t _position)
+{
+	return findStop(
+		_text,
+		_position,
+		SOL_BLOCK_PREDICATE(_mm_xor_si128(
+			_mm_or_si128(
+				_mm_or_si128(equal(_block, ' '), equal(_block, '\n')),
+				_mm_or_si128(equal(_block, '\t'), equal(_block, '\r'))
+			),
+			_mm_set1_epi8(-1)
+		)),
+		[](char _c) { return !isWhiteSpace(_c); }
+	);
+}
+
+size_t solidity::langutil::skipIdentifierParts(string const& _text, size_t _position)
+{
+	return findStop(
+		_text,
+		_position,
+		// Setting bit 5 maps upper case letters to lower case ones and no other character into 'a'-'z'.
+		SOL_BLOCK_PREDICATE(_mm_xor_si128(
+			_mm_or_si128(
+				_mm_or_si128(inRange(_mm_or_si128(_block, _mm_set1_epi8(0x20)), 'a', 'z'), inRange(_block, '0', '9')),
+				_mm_or_si128(equal(_block, '_'), equal(_block, '$'))
+			),
+			_mm_set1_epi8(-1)
+		)),
+		[](char _c) { return !isIdentifierPart(_c); }
+	);
+}
+
+size_t solidity::langutil::findLineBreakCandidate(string const& _text, size_t _position)
+{
+	return findStop(
+		_text,
+		_position,
+		SOL_BLOCK_PREDICATE(_mm_or_si128(
+			inRange(_block, 0x0a, 0x0d),
+			_mm_or_si128(equal(_block, static_cast<char>(0xc2)), equal(_block, static_cast<char>(0xe2)))
+		)),
+		[](char _c) {
+			auto c = static_cast<unsigned char>(_c);
+			return (0x0a <= c && c <= 0x0d) || c == 0xc2 || c == 0xe2;
+		}
+	);
+}
+
+size_t solidity::langutil::skipPlainStringCharacters(string const& _text, size_t _position, char _quote)
+{
+	return findStop(
+		_text,
+		_position,
+		SOL_BLOCK_PREDICATE(_mm_or_si128(
+			_mm_xor_si128(inRange(_block, 0x20, 0x7e), _mm_set1_epi8(-1)),
+			_mm_or_si128(equal(_block, '\\'), equal(_block, _quote))
+		)),
+		[&](char _c) {
+			auto c = static_cast<unsigned char>(_c);
+			return c < 0x20 || c > 0x7e || _c == '\\' || _c == _quote;
+		}
+	);
+}
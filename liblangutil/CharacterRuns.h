@@ -0,0 +1,49 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Functions that skip runs of characters of a certain class, used by the scanner
+ * to consume trivia, identifiers and string literals in blocks instead of one
+ * character at a time. They process 16 bytes at once if SSE2 is available.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace solidity::langutil
+{
+
+/// @returns the position of the first character at or after @a _position that is not
+/// whitespace in the sense of isWhiteSpace(), or the size of @a _text if there is none.
+size_t skipWhiteSpace(std::string const& _text, size_t _position);
+
+/// @returns the position of the first character at or after @a _position that is not
+/// an identifier part in the sense of isIdentifierPart(), or the size of @a _text.
+size_t skipIdentifierParts(std::string const& _text, size_t _position);
+
+/// @returns the position of the first character at or after @a _position that could start
+/// a line break (including the unicode ones, see Scanner::isUnicodeLinebreak()), or the size of @a _text.
+size_t findLineBreakCandidate(std::string const& _text, size_t _position);
+
+/// @returns the position of the first character at or after @a _position that is not
+/// printable ASCII or is a backslash or @a _quote, or the size of @a _text.
+/// The skipped characters can be copied into a string literal verbatim.
+size_t skipPlainStringCharacters(std::string const& _text, size_t _position, char _quote);
+
+}
@@ -50,6 +50,7 @@
  * Solidity scanner.
  */
 
+#include <liblangutil/CharacterRuns.h>
 #include <liblangutil/Common.h>
 #include <liblangutil/Exceptions.h>
 #include <liblangutil/Scanner.h>
@@ -256,8 +257,10 @@ Token Scanner::selectToken(char _next, Token _then, Token _else)
 bool Scanner::skipWhitespace()
 {
 	size_t const startPosition = sourcePos();
-	while (isWhiteSpace(m_char))
-		advance();
+	// m_char is not necessarily the character at the current position (see skipMultiLineComment),
+	// so it is consumed separately.
+	if (isWhiteSpace(m_char) && advance())
+		m_char = m_source->setPosition(langutil::skipWhiteSpace(source(), sourcePos()));
 	// Return whether or not we skipped any characters.
 	return sourcePos() != startPosition;
 }
@@ -275,8 +278,13 @@ Token Scanner::skipSingleLineComment()
 {
 	// Line terminator is not part of the comment. If it is a
 	// non-ascii line terminator, it will result in a parser error.
-	while (!isUnicodeLinebreak())
-		if (!advance()) break;
+	while (true)
+	{
+		m_char = m_source->setPosition(findLineBreakCandidate(source(), sourcePos()));
+		if (isSourcePastEndOfInput() || isUnicodeLinebreak())
+			break;
+		advance();
+	}
 
 	return Token::Whitespace;
 }
@@ -340,8 +348,13 @@ size_t Scanner::scanSingleLineDocComment()
 			// Any line terminator that is not '\n' is considered to end the
 			// comment.
 			break;
-		addCommentLiteralChar(m_char);
-		advance();
+		// Copy everything up to the next potential line break at once.
+		size_t const runStart = sourcePos();
+		size_t const runEnd = max(findLineBreakCandidate(source(), runStart + 1), runStart + 1);
+		m_skippedComments[NextNext].literal.append(source(), runStart, runEnd - runStart);
+		m_char = m_source->setPosition(runEnd);
+		// Same value as if the characters had been consumed one by one.
+		endPosition = runEnd - 1;
 	}
 	literal.complete();
 	return endPosition;
@@ -351,13 +364,17 @@ Token Scanner::skipMultiLineComment()
 {
 	while (!isSourcePastEndOfInput())
 	{
-		char ch = m_char;
+		// Only a '*' can start the terminator, skip to the next one.
+		size_t const star = source().find('*', sourcePos());
+		m_char = m_source->setPosition(star == string::npos ? source().size() : star);
+		if (isSourcePastEndOfInput())
+			break;
 		advance();
 
 		// If we have reached the end of the multi-line comment, we
 		// consume the '/' and insert a whitespace. This way all
 		// multi-line comments are treated as whitespace.
-		if (ch == '*' && m_char == '/')
+		if (m_char == '/')
 		{
 			m_char = ' ';
 			return Token::Whitespace;
@@ -790,6 +807,16 @@ Token Scanner::scanString(bool const _isUnicode)
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
 	while (m_char != quote && !isSourcePastEndOfInput() && !isUnicodeLinebreak())
 	{
+		// Printable ASCII characters other than the quote and backslash are copied verbatim.
+		size_t const runStart = sourcePos();
+		size_t const runEnd = skipPlainStringCharacters(source(), runStart, quote);
+		if (runEnd != runStart)
+		{
+			m_tokens[NextNext].literal.append(source(), runStart, runEnd - runStart);
+			m_char = m_source->setPosition(runEnd);
+			continue;
+		}
+
 		char c = m_char;
 		advance();
 		if (c == '\\')
@@ -964,10 +991,17 @@ tuple<Token, unsigned, unsigned> Scanner::scanIdentifierOrKeyword()
 {
 	solAssert(isIdentifierStart(m_char), "");
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
-	addLiteralCharAndAdvance();
+	size_t const start = sourcePos();
+	advance();
 	// Scan the rest of the identifier characters.
-	while (isIdentifierPart(m_char) || (m_char == '.' && m_kind == ScannerKind::Yul))
-		addLiteralCharAndAdvance();
+	m_char = m_source->setPosition(skipIdentifierParts(source(), sourcePos()));
+	while (m_char == '.' && m_kind == ScannerKind::Yul)
+	{
+		advance();
+		m_char = m_source->setPosition(skipIdentifierParts(source(), sourcePos()));
+	}
+	// Identifiers do not contain escapes, so they are copied from the source in one go.
+	m_tokens[NextNext].literal.assign(source(), start, sourcePos() - start);
 	literal.complete();
 	auto const token = TokenTraits::fromIdentifierOrKeyword(m_tokens[NextNext].literal);
 	if (m_kind == ScannerKind::Yul)
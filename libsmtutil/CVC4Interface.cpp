@@ -20,6 +20,7 @@
 
 #include <libsolutil/CommonIO.h>
 
+#include <cvc4/base/configuration.h>
 #include <cvc4/util/bitvector.h>
 
 using namespace std;
@@ -117,6 +118,23 @@ pair<CheckResult, vector<string>> CVC4Interface::check(vector<Expression> const&
 	return make_pair(result, values);
 }
 
+void CVC4Interface::interrupt()
+{
+	try
+	{
+		m_solver.interrupt();
+	}
+	catch (CVC4::Exception const&)
+	{
+		// Nothing to interrupt.
+	}
+}
+
+string CVC4Interface::identifier() const
+{
+	return "cvc4 " + CVC4::Configuration::getVersionString() + " rlimit " + to_string(resourceLimit);
+}
+
 CVC4::Expr CVC4Interface::toCVC4Expr(Expression const& _expr)
 {
 	// Variable
@@ -134,7 +152,7 @@ CVC4::Expr CVC4Interface::toCVC4Expr(Expression const& _expr)
 		if (!arguments.empty() && m_variables.count(_expr.name))
 			return m_context.mkExpr(CVC4::kind::APPLY_UF, m_variables.at(n), arguments);
 		// Literal
-		else if (arguments.empty())
+		else if (arguments.empty() && _expr.op() != Operator::TupleConstructor)
 		{
 			if (n == "true")
 				return m_context.mkConst(true);
@@ -158,51 +176,51 @@ CVC4::Expr CVC4Interface::toCVC4Expr(Expression const& _expr)
 		}
 
 		smtAssert(_expr.hasCorrectArity(), "");
-		if (n == "ite")
+		if (_expr.op() == Operator::Ite)
 			return arguments[0].iteExpr(arguments[1], arguments[2]);
-		else if (n == "not")
+		else if (_expr.op() == Operator::Not)
 			return arguments[0].notExpr();
-		else if (n == "and")
+		else if (_expr.op() == Operator::And)
 			return arguments[0].andExpr(arguments[1]);
-		else if (n == "or")
+		else if (_expr.op() == Operator::Or)
 			return arguments[0].orExpr(arguments[1]);
-		else if (n == "implies")
+		else if (_expr.op() == Operator::Implies)
 			return m_context.mkExpr(CVC4::kind::IMPLIES, arguments[0], arguments[1]);
-		else if (n == "=")
+		else if (_expr.op() == Operator::Equal)
 			return m_context.mkExpr(CVC4::kind::EQUAL, arguments[0], arguments[1]);
-		else if (n == "<")
+		else if (_expr.op() == Operator::Less)
 			return m_context.mkExpr(CVC4::kind::LT, arguments[0], arguments[1]);
-		else if (n == "<=")
+		else if (_expr.op() == Operator::LessOrEqual)
 			return m_context.mkExpr(CVC4::kind::LEQ, arguments[0], arguments[1]);
-		else if (n == ">")
+		else if (_expr.op() == Operator::Greater)
 			return m_context.mkExpr(CVC4::kind::GT, arguments[0], arguments[1]);
-		else if (n == ">=")
+		else if (_expr.op() == Operator::GreaterOrEqual)
 			return m_context.mkExpr(CVC4::kind::GEQ, arguments[0], arguments[1]);
-		else if (n == "+")
+		else if (_expr.op() == Operator::Add)
 			return m_context.mkExpr(CVC4::kind::PLUS, arguments[0], arguments[1]);
-		else if (n == "-")
+		else if (_expr.op() == Operator::Sub)
 			return m_context.mkExpr(CVC4::kind::MINUS, arguments[0], arguments[1]);
-		else if (n == "*")
+		else if (_expr.op() == Operator::Mul)
 			return m_context.mkExpr(CVC4::kind::MULT, arguments[0], arguments[1]);
-		else if (n == "/")
+		else if (_expr.op() == Operator::Div)
 			return m_context.mkExpr(CVC4::kind::INTS_DIVISION_TOTAL, arguments[0], arguments[1]);
-		else if (n == "mod")
+		else if (_expr.op() == Operator::Mod)
 			return m_context.mkExpr(CVC4::kind::INTS_MODULUS, arguments[0], arguments[1]);
-		else if (n == "bvnot")
+		else if (_expr.op() == Operator::BVNot)
 			return m_context.mkExpr(CVC4::kind::BITVECTOR_NOT, arguments[0]);
-		else if (n == "bvand")
+		else if (_expr.op() == Operator::BVAnd)
 			return m_context.mkExpr(CVC4::kind::BITVECTOR_AND, arguments[0], arguments[1]);
-		else if (n == "bvor")
+		else if (_expr.op() == Operator::BVOr)
 			return m_context.mkExpr(CVC4::kind::BITVECTOR_OR, arguments[0], arguments[1]);
-		else if (n == "bvxor")
+		else if (_expr.op() == Operator::BVXor)
 			return m_context.mkExpr(CVC4::kind::BITVECTOR_XOR, arguments[0], arguments[1]);
-		else if (n == "bvshl")
+		else if (_expr.op() == Operator::BVShl)
 			return m_context.mkExpr(CVC4::kind::BITVECTOR_SHL, arguments[0], arguments[1]);
-		else if (n == "bvlshr")
+		else if (_expr.op() == Operator::BVLShr)
 			return m_context.mkExpr(CVC4::kind::BITVECTOR_LSHR, arguments[0], arguments[1]);
-		else if (n == "bvashr")
+		else if (_expr.op() == Operator::BVAShr)
 			return m_context.mkExpr(CVC4::kind::BITVECTOR_ASHR, arguments[0], arguments[1]);
-		else if (n == "int2bv")
+		else if (_expr.op() == Operator::Int2BV)
 		{
 			size_t size = std::stoul(_expr.arguments[1].name);
 			auto i2bvOp = m_context.mkConst(CVC4::IntToBitVector(size));
@@ -217,7 +235,7 @@ CVC4::Expr CVC4Interface::toCVC4Expr(Expression const& _expr)
 				)
 			);
 		}
-		else if (n == "bv2int")
+		else if (_expr.op() == Operator::BV2Int)
 		{
 			auto intSort = dynamic_pointer_cast<IntSort>(_expr.sort);
 			smtAssert(intSort, "");
@@ -243,17 +261,17 @@ CVC4::Expr CVC4Interface::toCVC4Expr(Expression const& _expr)
 				)
 			);
 		}
-		else if (n == "select")
+		else if (_expr.op() == Operator::Select)
 			return m_context.mkExpr(CVC4::kind::SELECT, arguments[0], arguments[1]);
-		else if (n == "store")
+		else if (_expr.op() == Operator::Store)
 			return m_context.mkExpr(CVC4::kind::STORE, arguments[0], arguments[1], arguments[2]);
-		else if (n == "const_array")
+		else if (_expr.op() == Operator::ConstArray)
 		{
 			shared_ptr<SortSort> sortSort = std::dynamic_pointer_cast<SortSort>(_expr.arguments[0].sort);
 			smtAssert(sortSort, "");
 			return m_context.mkConst(CVC4::ArrayStoreAll(cvc4Sort(*sortSort->inner), arguments[1]));
 		}
-		else if (n == "tuple_get")
+		else if (_expr.op() == Operator::TupleGet)
 		{
 			shared_ptr<TupleSort> tupleSort = std::dynamic_pointer_cast<TupleSort>(_expr.arguments[0].sort);
 			smtAssert(tupleSort, "");
@@ -263,7 +281,7 @@ CVC4::Expr CVC4Interface::toCVC4Expr(Expression const& _expr)
 			CVC4::Expr s = dt[0][index].getSelector();
 			return m_context.mkExpr(CVC4::kind::APPLY_SELECTOR, s, arguments[0]);
 		}
-		else if (n == "tuple_constructor")
+		else if (_expr.op() == Operator::TupleConstructor)
 		{
 			shared_ptr<TupleSort> tupleSort = std::dynamic_pointer_cast<TupleSort>(_expr.sort);
 			smtAssert(tupleSort, "");
@@ -110,10 +110,7 @@ void SMTLib2Interface::addAssertion(Expression const& _expr)
 
 pair<CheckResult, vector<string>> SMTLib2Interface::check(vector<Expression> const& _expressionsToEvaluate)
 {
-	string response = querySolver(
-		boost::algorithm::join(m_accumulatedOutput, "\n") +
-		checkSatAndGetValuesCommand(_expressionsToEvaluate)
-	);
+	string response = querySolver(dumpQuery(_expressionsToEvaluate));
 
 	CheckResult result;
 	// TODO proper parsing
@@ -132,13 +129,29 @@ pair<CheckResult, vector<string>> SMTLib2Interface::check(vector<Expression> con
 	return make_pair(result, values);
 }
 
+string SMTLib2Interface::dumpQuery(vector<Expression> const& _expressionsToEvaluate)
+{
+	return
+		boost::algorithm::join(m_accumulatedOutput, "\n") +
+		checkSatAndGetValuesCommand(_expressionsToEvaluate);
+}
+
 string SMTLib2Interface::toSExpr(Expression const& _expr)
 {
 	if (_expr.arguments.empty())
+	{
+		// Constructors of tuples without components are applied without parentheses.
+		if (_expr.op() == Operator::TupleConstructor)
+		{
+			auto tupleSort = dynamic_pointer_cast<TupleSort>(_expr.sort);
+			smtAssert(tupleSort, "");
+			return "|" + tupleSort->name + "|";
+		}
 		return _expr.name;
+	}
 
 	std::string sexpr = "(";
-	if (_expr.name == "int2bv")
+	if (_expr.op() == Operator::Int2BV)
 	{
 		size_t size = std::stoul(_expr.arguments[1].name);
 		auto arg = toSExpr(_expr.arguments.front());
@@ -149,7 +162,7 @@ string SMTLib2Interface::toSExpr(Expression const& _expr)
 			"(" + int2bv + " " + arg + ") " +
 			"(bvneg (" + int2bv + " (- " + arg + ")))";
 	}
-	else if (_expr.name == "bv2int")
+	else if (_expr.op() == Operator::BV2Int)
 	{
 		auto intSort = dynamic_pointer_cast<IntSort>(_expr.sort);
 		smtAssert(intSort, "");
@@ -171,7 +184,7 @@ string SMTLib2Interface::toSExpr(Expression const& _expr)
 			nat + " " +
 			"(- (bvneg " + arg + "))";
 	}
-	else if (_expr.name == "const_array")
+	else if (_expr.op() == Operator::ConstArray)
 	{
 		smtAssert(_expr.arguments.size() == 2, "");
 		auto sortSort = std::dynamic_pointer_cast<SortSort>(_expr.arguments.at(0).sort);
@@ -181,7 +194,7 @@ string SMTLib2Interface::toSExpr(Expression const& _expr)
 		sexpr += "(as const " + toSmtLibSort(*arraySort) + ") ";
 		sexpr += toSExpr(_expr.arguments.at(1));
 	}
-	else if (_expr.name == "tuple_get")
+	else if (_expr.op() == Operator::TupleGet)
 	{
 		smtAssert(_expr.arguments.size() == 2, "");
 		auto tupleSort = dynamic_pointer_cast<TupleSort>(_expr.arguments.at(0).sort);
@@ -189,7 +202,7 @@ string SMTLib2Interface::toSExpr(Expression const& _expr)
 		smtAssert(index < tupleSort->members.size(), "");
 		sexpr += "|" + tupleSort->members.at(index) + "| " + toSExpr(_expr.arguments.at(0));
 	}
-	else if (_expr.name == "tuple_constructor")
+	else if (_expr.op() == Operator::TupleConstructor)
 	{
 		auto tupleSort = dynamic_pointer_cast<TupleSort>(_expr.sort);
 		smtAssert(tupleSort, "");
@@ -26,6 +26,12 @@
 #endif
 #include <libsmtutil/SMTLib2Interface.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::util;
@@ -35,8 +41,12 @@ using namespace solidity::smtutil;
 SMTPortfolio::SMTPortfolio(
 	map<h256, string> _smtlib2Responses,
 	frontend::ReadCallback::Callback _smtCallback,
-	[[maybe_unused]] SMTSolverChoice _enabledSolvers
-)
+	[[maybe_unused]] SMTSolverChoice _enabledSolvers,
+	SMTPortfolioMode _mode,
+	SMTQueryCache* _queryCache
+):
+	m_mode(_mode),
+	m_queryCache(_queryCache)
 {
 	m_solvers.emplace_back(make_unique<SMTLib2Interface>(move(_smtlib2Responses), move(_smtCallback)));
 #ifdef HAVE_Z3
@@ -109,22 +119,186 @@ void SMTPortfolio::addAssertion(Expression const& _expr)
  *   when it is told that this is a hard query to solve.
  *
  *   If all solvers return ERROR, the result is ERROR.
+ *
+ * In the concurrent modes all solvers are queried at the same time.
+ * In `RaceParanoid` mode all answers are awaited and combined as above,
+ * so the result (including the model) is the same as in `Sequential` mode.
+ * In `Race` mode, the first solver to answer the query wins and the others
+ * are interrupted, which means that conflicting answers are not detected
+ * and the model depends on which solver was the fastest.
 */
 pair<CheckResult, vector<string>> SMTPortfolio::check(vector<Expression> const& _expressionsToEvaluate)
+{
+	return checkAssuming({}, _expressionsToEvaluate);
+}
+
+pair<CheckResult, vector<string>> SMTPortfolio::checkAssuming(
+	vector<Expression> const& _assumptions,
+	vector<Expression> const& _expressionsToEvaluate
+)
+{
+	optional<SMTQueryCache::Query> query = cacheQuery(_assumptions, _expressionsToEvaluate);
+	if (query)
+		if (auto cached = m_queryCache->lookup(*query))
+		{
+			// The cache only holds the answer of the solvers that are linked into this binary.
+			// Unless that answer already won the race, the SMT-LIB2 interface is still asked,
+			// so that given responses are taken into account and unhandled queries are reported.
+			if (m_mode == SMTPortfolioMode::Race && solverAnswered(cached->first))
+				return *cached;
+			return mergeResults({checkSolver(0, _assumptions, _expressionsToEvaluate), *cached});
+		}
+
+	vector<SolverResult> results;
+	optional<size_t> winner;
+	if (m_mode == SMTPortfolioMode::Sequential || m_solvers.size() <= 1)
+		results = checkSequentially(_assumptions, _expressionsToEvaluate);
+	else
+		results = checkConcurrently(_assumptions, _expressionsToEvaluate, winner);
+
+	if (query && results.size() == m_solvers.size())
+	{
+		SolverResult nativeResult =
+			winner && *winner > 0 && m_mode == SMTPortfolioMode::Race ?
+			results.at(*winner) :
+			mergeResults({results.begin() + 1, results.end()});
+		m_queryCache->store(*query, nativeResult.first, nativeResult.second);
+	}
+
+	if (m_mode == SMTPortfolioMode::Race && winner)
+		return move(results.at(*winner));
+	return mergeResults(results);
+}
+
+SMTPortfolio::SolverResult SMTPortfolio::checkSolver(
+	size_t _index,
+	vector<Expression> const& _assumptions,
+	vector<Expression> const& _expressionsToEvaluate
+)
+{
+	if (_assumptions.empty())
+		return m_solvers[_index]->check(_expressionsToEvaluate);
+	return m_solvers[_index]->checkAssuming(_assumptions, _expressionsToEvaluate);
+}
+
+vector<SMTPortfolio::SolverResult> SMTPortfolio::checkSequentially(
+	vector<Expression> const& _assumptions,
+	vector<Expression> const& _expressionsToEvaluate
+)
+{
+	vector<SolverResult> results;
+	for (size_t i = 0; i < m_solvers.size(); ++i)
+	{
+		results.emplace_back(checkSolver(i, _assumptions, _expressionsToEvaluate));
+		// No need to ask the remaining solvers once two of them disagree.
+		if (mergeResults(results).first == CheckResult::CONFLICTING)
+			break;
+	}
+	return results;
+}
+
+vector<SMTPortfolio::SolverResult> SMTPortfolio::checkConcurrently(
+	vector<Expression> const& _assumptions,
+	vector<Expression> const& _expressionsToEvaluate,
+	optional<size_t>& _winner
+)
+{
+	size_t const solverCount = m_solvers.size();
+	vector<SolverResult> results(solverCount, {CheckResult::ERROR, {}});
+	vector<exception_ptr> exceptions(solverCount);
+	// Solvers are cancelled once the query is decided. A cancelled solver that has not
+	// started yet is not started at all, a running one is interrupted.
+	vector<bool> cancelled(solverCount, false);
+	vector<bool> finished(solverCount, false);
+	size_t finishedCount = 0;
+	mutex resultsMutex;
+	condition_variable resultArrived;
+
+	auto runSolver = [&](size_t _index)
+	{
+		SolverResult result{CheckResult::ERROR, {}};
+		exception_ptr exception;
+		bool skipped = false;
+		{
+			lock_guard<mutex> lock(resultsMutex);
+			skipped = cancelled[_index];
+		}
+		if (!skipped)
+			try
+			{
+				result = checkSolver(_index, _assumptions, _expressionsToEvaluate);
+			}
+			catch (...)
+			{
+				exception = current_exception();
+			}
+
+		lock_guard<mutex> lock(resultsMutex);
+		results[_index] = move(result);
+		exceptions[_index] = move(exception);
+		if (!_winner && solverAnswered(results[_index].first))
+			_winner = _index;
+		finished[_index] = true;
+		++finishedCount;
+		resultArrived.notify_all();
+	};
+	auto decided = [&]() {
+		return m_mode == SMTPortfolioMode::Race && _winner;
+	};
+
+	// The SMT-LIB2 interface might use the read callback, which is not required to be
+	// thread-safe, so it runs on the calling thread. Since it cannot be interrupted,
+	// it is only asked after the other solvers, unless one of them already won the race.
+	vector<thread> workers;
+	for (size_t i = 1; i < solverCount; ++i)
+		workers.emplace_back(runSolver, i);
+
+	{
+		unique_lock<mutex> lock(resultsMutex);
+		resultArrived.wait(lock, [&]() { return finishedCount == solverCount - 1 || decided(); });
+		if (decided())
+			cancelled[0] = true;
+	}
+	runSolver(0);
+
+	{
+		unique_lock<mutex> lock(resultsMutex);
+		for (size_t i = 0; i < solverCount; ++i)
+			if (!finished[i])
+				cancelled[i] = true;
+		// An interrupt that arrives before the solver started its query is lost,
+		// so it is repeated until the solver stopped.
+		while (finishedCount < solverCount)
+		{
+			for (size_t i = 0; i < solverCount; ++i)
+				if (!finished[i])
+					m_solvers[i]->interrupt();
+			resultArrived.wait_for(lock, chrono::milliseconds(10));
+		}
+	}
+
+	for (auto& worker: workers)
+		worker.join();
+
+	for (auto const& exception: exceptions)
+		if (exception)
+			rethrow_exception(exception);
+
+	return results;
+}
+
+SMTPortfolio::SolverResult SMTPortfolio::mergeResults(vector<SolverResult> const& _results)
 {
 	CheckResult lastResult = CheckResult::ERROR;
 	vector<string> finalValues;
-	for (auto const& s: m_solvers)
+	for (auto const& [result, values]: _results)
 	{
-		CheckResult result;
-		vector<string> values;
-		tie(result, values) = s->check(_expressionsToEvaluate);
 		if (solverAnswered(result))
 		{
 			if (!solverAnswered(lastResult))
 			{
 				lastResult = result;
-				finalValues = std::move(values);
+				finalValues = values;
 			}
 			else if (lastResult != result)
 			{
@@ -138,6 +312,38 @@ pair<CheckResult, vector<string>> SMTPortfolio::check(vector<Expression> const&
 	return make_pair(lastResult, finalValues);
 }
 
+optional<SMTQueryCache::Query> SMTPortfolio::cacheQuery(
+	vector<Expression> const& _assumptions,
+	vector<Expression> const& _expressionsToEvaluate
+)
+{
+	// Answers that are provided via the SMT-LIB2 interface are already keyed by the query hash,
+	// so we only cache if there are solvers in addition to it.
+	if (!m_queryCache || m_solvers.size() <= 1)
+		return nullopt;
+
+	string solverIdentifier = "portfolio " + to_string(static_cast<unsigned>(m_mode));
+	for (size_t i = 1; i < m_solvers.size(); ++i)
+	{
+		string identifier = m_solvers[i]->identifier();
+		if (identifier.empty())
+			return nullopt;
+		solverIdentifier += ", " + identifier;
+	}
+
+	auto smtlib2 = dynamic_cast<SMTLib2Interface*>(m_solvers.front().get());
+	smtAssert(smtlib2, "");
+	set<string> symbols;
+	for (auto const& variable: smtlib2->variables())
+		symbols.insert(variable.first);
+	// The SMT-LIB2 interface asserts the assumptions in a new scope, do the same for the dump.
+	smtlib2->push();
+	ScopeGuard popScope([&]() { smtlib2->pop(); });
+	for (auto const& assumption: _assumptions)
+		smtlib2->addAssertion(assumption);
+	return SMTQueryCache::normalise(smtlib2->dumpQuery(_expressionsToEvaluate), symbols, solverIdentifier);
+}
+
 vector<string> SMTPortfolio::unhandledQueries()
 {
 	// This code assumes that the constructor guarantees that
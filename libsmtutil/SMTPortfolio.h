@@ -19,12 +19,14 @@
 #pragma once
 
 
+#include <libsmtutil/SMTQueryCache.h>
 #include <libsmtutil/SolverInterface.h>
 #include <libsolidity/interface/ReadFile.h>
 #include <libsolutil/FixedHash.h>
 
 #include <boost/noncopyable.hpp>
 #include <map>
+#include <optional>
 #include <vector>
 
 namespace solidity::smtutil
@@ -35,6 +37,11 @@ namespace solidity::smtutil
  * propagating the functionalities to all solvers.
  * It also checks whether different solvers give conflicting answers
  * to SMT queries.
+ * Depending on the mode, queries are sent to the solvers one after the other
+ * or to all of them concurrently (see SMTPortfolioMode).
+ * If a query cache is given, the answers of the solvers that are linked into
+ * this binary are stored in and retrieved from it. The SMT-LIB2 interface is
+ * not cached, since its answers depend on the responses given by the user.
  */
 class SMTPortfolio: public SolverInterface, public boost::noncopyable
 {
@@ -42,7 +49,9 @@ public:
 	SMTPortfolio(
 		std::map<util::h256, std::string> _smtlib2Responses = {},
 		frontend::ReadCallback::Callback _smtCallback = {},
-		SMTSolverChoice _enabledSolvers = SMTSolverChoice::All()
+		SMTSolverChoice _enabledSolvers = SMTSolverChoice::All(),
+		SMTPortfolioMode _mode = SMTPortfolioMode::Sequential,
+		SMTQueryCache* _queryCache = nullptr
 	);
 
 	void reset() override;
@@ -55,13 +64,51 @@ public:
 	void addAssertion(Expression const& _expr) override;
 
 	std::pair<CheckResult, std::vector<std::string>> check(std::vector<Expression> const& _expressionsToEvaluate) override;
+	std::pair<CheckResult, std::vector<std::string>> checkAssuming(
+		std::vector<Expression> const& _assumptions,
+		std::vector<Expression> const& _expressionsToEvaluate
+	) override;
 
 	std::vector<std::string> unhandledQueries() override;
 	unsigned solvers() override { return m_solvers.size(); }
 private:
+	using SolverResult = std::pair<CheckResult, std::vector<std::string>>;
+
+	/// Queries solver number @a _index under @a _assumptions.
+	SolverResult checkSolver(
+		size_t _index,
+		std::vector<Expression> const& _assumptions,
+		std::vector<Expression> const& _expressionsToEvaluate
+	);
+	/// Queries all solvers one after the other.
+	std::vector<SolverResult> checkSequentially(
+		std::vector<Expression> const& _assumptions,
+		std::vector<Expression> const& _expressionsToEvaluate
+	);
+	/// Queries all solvers concurrently. In `Race` mode, returns as soon as
+	/// one of the solvers answered the query and @a _winner is set to its index.
+	/// The SMT-LIB2 interface is only asked once the other solvers are done,
+	/// and not at all if one of them already won the race.
+	std::vector<SolverResult> checkConcurrently(
+		std::vector<Expression> const& _assumptions,
+		std::vector<Expression> const& _expressionsToEvaluate,
+		std::optional<size_t>& _winner
+	);
+	/// Combines the results of the individual solvers into a single result.
+	static SolverResult mergeResults(std::vector<SolverResult> const& _results);
+
+	/// @returns the normalised current query for the query cache, or nullopt
+	/// if the answers of the current solvers cannot be cached.
+	std::optional<SMTQueryCache::Query> cacheQuery(
+		std::vector<Expression> const& _assumptions,
+		std::vector<Expression> const& _expressionsToEvaluate
+	);
+
 	static bool solverAnswered(CheckResult result);
 
 	std::vector<std::unique_ptr<SolverInterface>> m_solvers;
+	SMTPortfolioMode m_mode;
+	SMTQueryCache* m_queryCache = nullptr;
 
 	std::vector<Expression> m_assertions;
 };
@@ -0,0 +1,270 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsmtutil/SMTQueryCache.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/JSON.h>
+#include <libsolutil/Keccak256.h>
+
+#include <fstream>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::smtutil;
+
+namespace
+{
+
+/// Version of the format of the cache entries, part of every key.
+string const c_cacheFormatVersion = "1";
+
+string resultToString(CheckResult _result)
+{
+	switch (_result)
+	{
+	case CheckResult::SATISFIABLE: return "sat";
+	case CheckResult::UNSATISFIABLE: return "unsat";
+	case CheckResult::UNKNOWN: return "unknown";
+	case CheckResult::CONFLICTING: return "conflicting";
+	case CheckResult::ERROR: return "error";
+	}
+	smtAssert(false, "");
+}
+
+optional<CheckResult> resultFromString(string const& _result)
+{
+	if (_result == "sat")
+		return CheckResult::SATISFIABLE;
+	else if (_result == "unsat")
+		return CheckResult::UNSATISFIABLE;
+	else if (_result == "unknown")
+		return CheckResult::UNKNOWN;
+	return nullopt;
+}
+
+string translate(string const& _name, map<string, string> const& _renaming)
+{
+	auto it = _renaming.find(_name);
+	return it == _renaming.end() ? _name : it->second;
+}
+
+}
+
+SMTQueryCache::SMTQueryCache(boost::filesystem::path _directory):
+	m_directory(move(_directory))
+{
+	boost::system::error_code error;
+	boost::filesystem::create_directories(m_directory, error);
+}
+
+SMTQueryCache::Query SMTQueryCache::normalise(
+	string const& _query,
+	set<string> const& _symbols,
+	string const& _solverIdentifier
+)
+{
+	Query query;
+	string normalised;
+	normalised.reserve(_query.size());
+
+	auto isDelimiter = [](char _c) {
+		return _c == '(' || _c == ')' || _c == '|' || _c == ' ' || _c == '\n' || _c == '\t' || _c == '\r';
+	};
+
+	size_t pos = 0;
+	while (pos < _query.size())
+	{
+		size_t end = pos;
+		string symbol;
+		if (_query[pos] == '|')
+		{
+			end = _query.find('|', pos + 1);
+			if (end == string::npos)
+				end = _query.size();
+			else
+				++end;
+			symbol = _query.substr(pos + 1, end - pos - 2);
+		}
+		else if (!isDelimiter(_query[pos]))
+		{
+			while (end < _query.size() && !isDelimiter(_query[end]))
+				++end;
+			symbol = _query.substr(pos, end - pos);
+		}
+		else
+		{
+			normalised += _query[pos++];
+			continue;
+		}
+
+		if (_symbols.count(symbol))
+		{
+			auto [it, inserted] = query.renaming.emplace(symbol, "");
+			if (inserted)
+				// '!' cannot occur in the names generated by the SMTChecker.
+				it->second = "!" + to_string(query.renaming.size() - 1);
+			normalised += "|" + it->second + "|";
+		}
+		else
+			normalised.append(_query, pos, end - pos);
+		pos = end;
+	}
+
+	query.key = keccak256(c_cacheFormatVersion + "\n" + _solverIdentifier + "\n" + normalised);
+	return query;
+}
+
+optional<pair<CheckResult, vector<string>>> SMTQueryCache::lookup(Query const& _query) const
+{
+	optional<Json::Value> entry = readEntry(_query.key);
+	if (!entry || !(*entry)["values"].isArray())
+		return nullopt;
+	optional<CheckResult> result = resultFromString((*entry)["result"].asString());
+	if (!result)
+		return nullopt;
+
+	vector<string> values;
+	for (auto const& value: (*entry)["values"])
+		values.emplace_back(value.asString());
+	return make_pair(*result, move(values));
+}
+
+void SMTQueryCache::store(Query const& _query, CheckResult _result, vector<string> const& _values)
+{
+	if (!cacheable(_result))
+		return;
+
+	Json::Value entry{Json::objectValue};
+	entry["result"] = resultToString(_result);
+	entry["values"] = Json::arrayValue;
+	for (auto const& value: _values)
+		entry["values"].append(value);
+	writeEntry(_query.key, entry);
+}
+
+optional<pair<CheckResult, CHCSolverInterface::CexGraph>> SMTQueryCache::lookupCHC(Query const& _query) const
+{
+	optional<Json::Value> entry = readEntry(_query.key);
+	if (!entry || !(*entry)["nodes"].isArray() || !(*entry)["edges"].isArray())
+		return nullopt;
+	optional<CheckResult> result = resultFromString((*entry)["result"].asString());
+	if (!result)
+		return nullopt;
+
+	map<string, string> inverse;
+	for (auto const& [original, normalised]: _query.renaming)
+		inverse.emplace(normalised, original);
+
+	CHCSolverInterface::CexGraph cex;
+	for (auto const& node: (*entry)["nodes"])
+	{
+		vector<string> arguments;
+		for (auto const& argument: node["arguments"])
+			arguments.emplace_back(argument.asString());
+		cex.nodes[node["id"].asUInt()] = {translate(node["name"].asString(), inverse), move(arguments)};
+	}
+	for (auto const& edge: (*entry)["edges"])
+	{
+		vector<unsigned> targets;
+		for (auto const& target: edge["targets"])
+			targets.emplace_back(target.asUInt());
+		cex.edges[edge["id"].asUInt()] = move(targets);
+	}
+	return make_pair(*result, move(cex));
+}
+
+void SMTQueryCache::storeCHC(Query const& _query, CheckResult _result, CHCSolverInterface::CexGraph const& _cex)
+{
+	if (!cacheable(_result))
+		return;
+
+	Json::Value entry{Json::objectValue};
+	entry["result"] = resultToString(_result);
+	entry["nodes"] = Json::arrayValue;
+	for (auto const& [id, node]: _cex.nodes)
+	{
+		Json::Value jsonNode{Json::objectValue};
+		jsonNode["id"] = id;
+		jsonNode["name"] = translate(node.first, _query.renaming);
+		jsonNode["arguments"] = Json::arrayValue;
+		for (auto const& argument: node.second)
+			jsonNode["arguments"].append(argument);
+		entry["nodes"].append(jsonNode);
+	}
+	entry["edges"] = Json::arrayValue;
+	for (auto const& [id, targets]: _cex.edges)
+	{
+		Json::Value jsonEdge{Json::objectValue};
+		jsonEdge["id"] = id;
+		jsonEdge["targets"] = Json::arrayValue;
+		for (auto target: targets)
+			jsonEdge["targets"].append(target);
+		entry["edges"].append(jsonEdge);
+	}
+	writeEntry(_query.key, entry);
+}
+
+bool SMTQueryCache::cacheable(CheckResult _result)
+{
+	// Solvers run with a resource limit, which makes UNKNOWN deterministic as well.
+	return
+		_result == CheckResult::SATISFIABLE ||
+		_result == CheckResult::UNSATISFIABLE ||
+		_result == CheckResult::UNKNOWN;
+}
+
+boost::filesystem::path SMTQueryCache::entryPath(h256 const& _key) const
+{
+	return m_directory / (_key.hex() + ".json");
+}
+
+optional<Json::Value> SMTQueryCache::readEntry(h256 const& _key) const
+{
+	string content = readFileAsString(entryPath(_key).string());
+	Json::Value entry;
+	if (content.empty() || !jsonParseStrict(content, entry) || !entry.isObject())
+		return nullopt;
+	return entry;
+}
+
+void SMTQueryCache::writeEntry(h256 const& _key, Json::Value const& _entry)
+{
+	boost::filesystem::path path = entryPath(_key);
+	// Write to a temporary file first, so that concurrent readers never see partial entries.
+	boost::filesystem::path temporary = path;
+	temporary += "." + boost::filesystem::unique_path().string() + ".tmp";
+	{
+		ofstream file(temporary.string(), ios::binary | ios::trunc);
+		if (!file)
+			return;
+		file << jsonCompactPrint(_entry);
+		if (!file)
+		{
+			file.close();
+			boost::system::error_code error;
+			boost::filesystem::remove(temporary, error);
+			return;
+		}
+	}
+	boost::system::error_code error;
+	boost::filesystem::rename(temporary, path, error);
+	if (error)
+		boost::filesystem::remove(temporary, error);
+}
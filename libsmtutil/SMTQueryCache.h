@@ -0,0 +1,94 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#pragma once
+
+#include <libsmtutil/CHCSolverInterface.h>
+#include <libsmtutil/SolverInterface.h>
+
+#include <libsolutil/FixedHash.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/noncopyable.hpp>
+
+#include <json/json.h>
+
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace solidity::smtutil
+{
+
+/**
+ * Persistent cache of SMT query results, stored as one JSON file per query
+ * inside a directory, so that it survives between compiler invocations and
+ * can be shared by concurrent ones.
+ *
+ * Queries are keyed by the hash of their normalised textual form together with
+ * an identifier of the solver (name, version and relevant options).
+ * Normalisation renames the declared symbols in the order of their first occurrence.
+ * Since symbol names contain AST IDs, this allows to reuse the results of queries
+ * that only differ because unrelated code was changed.
+ *
+ * The cache is best-effort: entries that cannot be read or written are ignored.
+ */
+class SMTQueryCache: public boost::noncopyable
+{
+public:
+	/// A query in normalised form.
+	struct Query
+	{
+		util::h256 key;
+		/// Maps the original symbol names to the normalised ones.
+		std::map<std::string, std::string> renaming;
+	};
+
+	explicit SMTQueryCache(boost::filesystem::path _directory);
+
+	/// Normalises the SMT-LIB2 text @a _query by renaming @a _symbols
+	/// (which may appear quoted or unquoted) and computes the cache key
+	/// for the solver identified by @a _solverIdentifier.
+	static Query normalise(
+		std::string const& _query,
+		std::set<std::string> const& _symbols,
+		std::string const& _solverIdentifier
+	);
+
+	std::optional<std::pair<CheckResult, std::vector<std::string>>> lookup(Query const& _query) const;
+	void store(Query const& _query, CheckResult _result, std::vector<std::string> const& _values);
+
+	/// Variants for Horn queries. Predicate names in the counterexample graph
+	/// are stored in normalised form and translated back on lookup.
+	std::optional<std::pair<CheckResult, CHCSolverInterface::CexGraph>> lookupCHC(Query const& _query) const;
+	void storeCHC(Query const& _query, CheckResult _result, CHCSolverInterface::CexGraph const& _cex);
+
+	/// @returns true if results of this kind are deterministic and can be cached.
+	static bool cacheable(CheckResult _result);
+
+private:
+	boost::filesystem::path entryPath(util::h256 const& _key) const;
+	std::optional<Json::Value> readEntry(util::h256 const& _key) const;
+	void writeEntry(util::h256 const& _key, Json::Value const& _entry);
+
+	boost::filesystem::path m_directory;
+};
+
+}
@@ -0,0 +1,102 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsmtutil/SolverInterface.h>
+
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::smtutil;
+
+namespace
+{
+
+/// The argument lists of all live expression nodes, keyed by the identity of the node.
+struct ArgumentStore
+{
+	mutex lock;
+	unordered_map<string, pair<vector<Expression> const*, weak_ptr<vector<Expression> const>>> lists;
+};
+
+ArgumentStore& argumentStore()
+{
+	// Never destroyed, since expressions with static storage duration might outlive it.
+	static ArgumentStore* store = new ArgumentStore();
+	return *store;
+}
+
+void appendIdentity(string& _key, void const* _object)
+{
+	auto address = reinterpret_cast<uintptr_t>(_object);
+	_key.append(reinterpret_cast<char const*>(&address), sizeof(address));
+}
+
+/// @returns the key of the node called @a _name of sort @a _sort applied to @a _arguments.
+/// Names cannot contain null characters and identities are of fixed size, so the key is unambiguous.
+string nodeKey(string const& _name, SortPointer const& _sort, vector<Expression> const& _arguments)
+{
+	string key = _name;
+	key += '\0';
+	appendIdentity(key, _sort.get());
+	for (auto const& argument: _arguments)
+	{
+		key += argument.name;
+		key += '\0';
+		appendIdentity(key, argument.sort.get());
+		appendIdentity(key, argument.arguments.storage());
+	}
+	return key;
+}
+
+}
+
+ExpressionArguments::ExpressionArguments(
+	string const& _name,
+	SortPointer const& _sort,
+	vector<Expression> _arguments
+)
+{
+	if (_arguments.empty())
+		return;
+
+	string key = nodeKey(_name, _sort, _arguments);
+	ArgumentStore& store = argumentStore();
+	lock_guard<mutex> guard(store.lock);
+	auto& [list, weakList] = store.lists[key];
+	m_arguments = weakList.lock();
+	if (m_arguments)
+		return;
+
+	list = new vector<Expression>(move(_arguments));
+	m_arguments = shared_ptr<vector<Expression> const>(list, [key = move(key)](vector<Expression> const* _list) {
+		ArgumentStore& store = argumentStore();
+		{
+			lock_guard<mutex> guard(store.lock);
+			auto it = store.lists.find(key);
+			// The entry might already refer to a new node with the same key.
+			if (it != store.lists.end() && it->second.first == _list)
+				store.lists.erase(it);
+		}
+		// Deleting the list releases the arguments, which needs the lock.
+		delete _list;
+	});
+	weakList = m_arguments;
+}
@@ -27,6 +27,7 @@
 #include <cstdio>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -53,6 +54,80 @@ enum class CheckResult
 	SATISFIABLE, UNSATISFIABLE, UNKNOWN, CONFLICTING, ERROR
 };
 
+/// Strategy used by SMTPortfolio to distribute a query among its solvers.
+enum class SMTPortfolioMode
+{
+	/// Queries the solvers one after the other and compares all answers.
+	Sequential,
+	/// Queries the solvers concurrently and returns the first SAT/UNSAT answer,
+	/// interrupting the solvers that are still running.
+	Race,
+	/// Queries the solvers concurrently, but waits for all of them
+	/// in order to detect conflicting answers.
+	RaceParanoid
+};
+
+/// @returns the portfolio mode called @a _mode ("sequential", "race" or "paranoid"),
+/// or nullopt if there is no such mode.
+inline std::optional<SMTPortfolioMode> smtPortfolioModeFromString(std::string const& _mode)
+{
+	if (_mode == "sequential")
+		return SMTPortfolioMode::Sequential;
+	else if (_mode == "race")
+		return SMTPortfolioMode::Race;
+	else if (_mode == "paranoid")
+		return SMTPortfolioMode::RaceParanoid;
+	return std::nullopt;
+}
+
+/// Interned kinds of the built-in SMTLIB2 operators,
+/// so that they do not have to be identified by their name.
+enum class Operator
+{
+	/// Variables, literals and applications of uninterpreted functions.
+	None,
+	Ite, Not, And, Or, Implies, Equal,
+	Less, LessOrEqual, Greater, GreaterOrEqual,
+	Add, Sub, Mul, Div, Mod,
+	BVNot, BVAnd, BVOr, BVXor, BVShl, BVLShr, BVAShr,
+	Int2BV, BV2Int,
+	Select, Store, ConstArray,
+	TupleGet, TupleConstructor
+};
+
+class Expression;
+
+/// Immutable list of the arguments of an expression.
+/// The lists are hash-consed: an expression with the same name, sort and arguments
+/// as a live one shares the list of the latter. Arguments are compared by their name,
+/// the identity of their sort and the identity of their own list, so a list identifies
+/// the expression node it belongs to, and identical subterms form a DAG instead of copies.
+/// Terms that are built from distinct but equal sort objects are not shared.
+class ExpressionArguments
+{
+public:
+	ExpressionArguments() = default;
+	/// Creates or looks up the arguments of an expression called @a _name of sort @a _sort.
+	ExpressionArguments(std::string const& _name, SortPointer const& _sort, std::vector<Expression> _arguments);
+
+	bool empty() const { return !m_arguments; }
+	size_t size() const;
+	Expression const& operator[](size_t _index) const;
+	Expression const& at(size_t _index) const;
+	Expression const& front() const;
+	Expression const* begin() const;
+	Expression const* end() const;
+
+	/// @returns the address of the shared storage, which identifies the
+	/// expression node that owns these arguments, or nullptr if there are none.
+	void const* storage() const { return m_arguments.get(); }
+	/// @returns a reference to the shared storage that expires together with the node.
+	std::weak_ptr<void const> weakStorage() const { return m_arguments; }
+
+private:
+	std::shared_ptr<std::vector<Expression> const> m_arguments;
+};
+
 /// C++ representation of an SMTLIB2 expression.
 class Expression
 {
@@ -72,46 +147,19 @@ public:
 
 	bool hasCorrectArity() const
 	{
-		if (name == "tuple_constructor")
+		if (m_operator == Operator::TupleConstructor)
 		{
 			auto tupleSort = std::dynamic_pointer_cast<TupleSort>(sort);
 			smtAssert(tupleSort, "");
 			return arguments.size() == tupleSort->components.size();
 		}
 
-		static std::map<std::string, unsigned> const operatorsArity{
-			{"ite", 3},
-			{"not", 1},
-			{"and", 2},
-			{"or", 2},
-			{"implies", 2},
-			{"=", 2},
-			{"<", 2},
-			{"<=", 2},
-			{">", 2},
-			{">=", 2},
-			{"+", 2},
-			{"-", 2},
-			{"*", 2},
-			{"/", 2},
-			{"mod", 2},
-			{"bvnot", 1},
-			{"bvand", 2},
-			{"bvor", 2},
-			{"bvxor", 2},
-			{"bvshl", 2},
-			{"bvlshr", 2},
-			{"bvashr", 2},
-			{"int2bv", 2},
-			{"bv2int", 1},
-			{"select", 2},
-			{"store", 3},
-			{"const_array", 2},
-			{"tuple_get", 2}
-		};
-		return operatorsArity.count(name) && operatorsArity.at(name) == arguments.size();
+		return m_operator != Operator::None && arity(m_operator) == arguments.size();
 	}
 
+	/// @returns the built-in operator applied by this expression, if any.
+	Operator op() const { return m_operator; }
+
 	static Expression ite(Expression _condition, Expression _trueValue, Expression _falseValue)
 	{
 		smtAssert(*_trueValue.sort == *_falseValue.sort, "");
@@ -337,17 +385,32 @@ public:
 		smtAssert(fSort, "");
 		return Expression(name, std::move(_arguments), fSort->codomain);
 	}
+	/// @returns an expression with the name and sort of this one, applied to @a _arguments.
+	Expression withArguments(std::vector<Expression> _arguments) const
+	{
+		return Expression(name, std::move(_arguments), sort);
+	}
 
 	std::string name;
-	std::vector<Expression> arguments;
+	ExpressionArguments arguments;
 	SortPointer sort;
 
 private:
 	/// Manual constructors, should only be used by SolverInterface and this class itself.
 	Expression(std::string _name, std::vector<Expression> _arguments, SortPointer _sort):
-		name(std::move(_name)), arguments(std::move(_arguments)), sort(std::move(_sort)) {}
+		name(std::move(_name)),
+		arguments(name, _sort, std::move(_arguments)),
+		sort(std::move(_sort)),
+		m_operator(intern(name))
+	{}
 	Expression(std::string _name, std::vector<Expression> _arguments, Kind _kind):
-		Expression(std::move(_name), std::move(_arguments), std::make_shared<Sort>(_kind)) {}
+		Expression(
+			std::move(_name),
+			std::move(_arguments),
+			// Share the boolean sort, so that boolean terms can be hash-consed.
+			_kind == Kind::Bool ? SortProvider::boolSort : std::make_shared<Sort>(_kind)
+		)
+	{}
 
 	explicit Expression(std::string _name, Kind _kind):
 		Expression(std::move(_name), std::vector<Expression>{}, _kind) {}
@@ -355,8 +418,98 @@ private:
 		Expression(std::move(_name), std::vector<Expression>{std::move(_arg)}, _kind) {}
 	Expression(std::string _name, Expression _arg1, Expression _arg2, Kind _kind):
 		Expression(std::move(_name), std::vector<Expression>{std::move(_arg1), std::move(_arg2)}, _kind) {}
+
+	/// @returns the operator with the given SMTLIB2 name, or Operator::None.
+	static Operator intern(std::string const& _name)
+	{
+		static std::map<std::string, Operator> const operators{
+			{"ite", Operator::Ite},
+			{"not", Operator::Not},
+			{"and", Operator::And},
+			{"or", Operator::Or},
+			{"implies", Operator::Implies},
+			{"=", Operator::Equal},
+			{"<", Operator::Less},
+			{"<=", Operator::LessOrEqual},
+			{">", Operator::Greater},
+			{">=", Operator::GreaterOrEqual},
+			{"+", Operator::Add},
+			{"-", Operator::Sub},
+			{"*", Operator::Mul},
+			{"/", Operator::Div},
+			{"mod", Operator::Mod},
+			{"bvnot", Operator::BVNot},
+			{"bvand", Operator::BVAnd},
+			{"bvor", Operator::BVOr},
+			{"bvxor", Operator::BVXor},
+			{"bvshl", Operator::BVShl},
+			{"bvlshr", Operator::BVLShr},
+			{"bvashr", Operator::BVAShr},
+			{"int2bv", Operator::Int2BV},
+			{"bv2int", Operator::BV2Int},
+			{"select", Operator::Select},
+			{"store", Operator::Store},
+			{"const_array", Operator::ConstArray},
+			{"tuple_get", Operator::TupleGet},
+			{"tuple_constructor", Operator::TupleConstructor}
+		};
+		auto it = operators.find(_name);
+		return it == operators.end() ? Operator::None : it->second;
+	}
+
+	static size_t arity(Operator _operator)
+	{
+		switch (_operator)
+		{
+		case Operator::Not:
+		case Operator::BVNot:
+		case Operator::BV2Int:
+			return 1;
+		case Operator::Ite:
+		case Operator::Store:
+			return 3;
+		case Operator::None:
+		case Operator::TupleConstructor:
+			return 0;
+		default:
+			return 2;
+		}
+	}
+
+	Operator m_operator = Operator::None;
 };
 
+inline size_t ExpressionArguments::size() const
+{
+	return m_arguments ? m_arguments->size() : 0;
+}
+
+inline Expression const& ExpressionArguments::operator[](size_t _index) const
+{
+	return (*m_arguments)[_index];
+}
+
+inline Expression const& ExpressionArguments::at(size_t _index) const
+{
+	smtAssert(_index < size(), "");
+	return (*m_arguments)[_index];
+}
+
+inline Expression const& ExpressionArguments::front() const
+{
+	return at(0);
+}
+
+inline Expression const* ExpressionArguments::begin() const
+{
+	return m_arguments ? m_arguments->data() : nullptr;
+}
+
+inline Expression const* ExpressionArguments::end() const
+{
+	return m_arguments ? m_arguments->data() + m_arguments->size() : nullptr;
+}
+
 DEV_SIMPLE_EXCEPTION(SolverError);
 
 class SolverInterface
@@ -384,9 +537,33 @@ public:
 	virtual std::pair<CheckResult, std::vector<std::string>>
 	check(std::vector<Expression> const& _expressionsToEvaluate) = 0;
 
+	/// Like `check`, but also assumes @a _assumptions, which are not kept
+	/// afterwards (check-sat-assuming).
+	/// The default implementation asserts them in a new scope, which is popped afterwards.
+	/// Solvers that support assumptions can keep the internal representation of
+	/// the terms shared between subsequent queries.
+	virtual std::pair<CheckResult, std::vector<std::string>>
+	checkAssuming(std::vector<Expression> const& _assumptions, std::vector<Expression> const& _expressionsToEvaluate)
+	{
+		push();
+		ScopeGuard popScope([&]() { pop(); });
+		for (auto const& assumption: _assumptions)
+			addAssertion(assumption);
+		return check(_expressionsToEvaluate);
+	}
+
+	/// Asks a `check` that is running concurrently to return as soon as possible.
+	/// Can be called from a thread other than the one running `check`
+	/// and has no effect if no query is running.
+	virtual void interrupt() {}
+
 	/// @returns a list of queries that the system was not able to respond to.
 	virtual std::vector<std::string> unhandledQueries() { return {}; }
 
+	/// @returns a string identifying the solver, its version and the options
+	/// that influence its answers, or an empty string if its answers must not be cached.
+	virtual std::string identifier() const { return {}; }
+
 	/// @returns how many SMT solvers this interface has.
 	virtual unsigned solvers() { return 1; }
 };
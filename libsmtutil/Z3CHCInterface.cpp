@@ -20,6 +20,7 @@
 
 #include <libsolutil/CommonIO.h>
 
+#include <optional>
 #include <set>
 #include <stack>
 
@@ -27,10 +28,11 @@ using namespace std;
 using namespace solidity;
 using namespace solidity::smtutil;
 
-Z3CHCInterface::Z3CHCInterface():
+Z3CHCInterface::Z3CHCInterface(SMTQueryCache* _queryCache):
 	m_z3Interface(make_unique<Z3Interface>()),
 	m_context(m_z3Interface->context()),
-	m_solver(*m_context)
+	m_solver(*m_context),
+	m_queryCache(_queryCache)
 {
 	// These need to be set globally.
 	z3::set_param("rewriter.pull_cheap_ite", true);
@@ -47,32 +49,55 @@ void Z3CHCInterface::declareVariable(string const& _name, SortPointer const& _so
 
 void Z3CHCInterface::registerRelation(Expression const& _expr)
 {
-	m_solver.register_relation(m_z3Interface->functions().at(_expr.name));
+	z3::func_decl relation = m_z3Interface->functions().at(_expr.name);
+	m_solver.register_relation(relation);
+	m_relations.emplace_back(relation);
 }
 
 void Z3CHCInterface::addRule(Expression const& _expr, string const& _name)
 {
 	z3::expr rule = m_z3Interface->toZ3Expr(_expr);
-	if (m_z3Interface->constants().empty())
-		m_solver.add_rule(rule, m_context->str_symbol(_name.c_str()));
-	else
+	if (!m_z3Interface->constants().empty())
 	{
 		z3::expr_vector variables(*m_context);
 		for (auto const& var: m_z3Interface->constants())
 			variables.push_back(var.second);
-		z3::expr boundRule = z3::forall(variables, rule);
-		m_solver.add_rule(boundRule, m_context->str_symbol(_name.c_str()));
+		rule = z3::forall(variables, rule);
 	}
+	m_solver.add_rule(rule, m_context->str_symbol(_name.c_str()));
+	m_rules.emplace_back(rule, _name);
 }
 
 pair<CheckResult, CHCSolverInterface::CexGraph> Z3CHCInterface::query(Expression const& _expr)
+{
+	optional<z3::expr> z3Expr;
+	try
+	{
+		z3Expr = m_z3Interface->toZ3Expr(_expr);
+	}
+	catch (z3::exception const&)
+	{
+		return {CheckResult::ERROR, {}};
+	}
+
+	if (!m_queryCache)
+		return solve(*z3Expr);
+
+	SMTQueryCache::Query query = cacheQuery(*z3Expr);
+	if (auto cached = m_queryCache->lookupCHC(query))
+		return *cached;
+	auto result = solve(*z3Expr);
+	m_queryCache->storeCHC(query, result.first, result.second);
+	return result;
+}
+
+pair<CheckResult, CHCSolverInterface::CexGraph> Z3CHCInterface::solve(z3::expr _query)
 {
 	CheckResult result;
 	CHCSolverInterface::CexGraph cex;
 	try
 	{
-		z3::expr z3Expr = m_z3Interface->toZ3Expr(_expr);
-		switch (m_solver.query(z3Expr))
+		switch (m_solver.query(_query))
 		{
 		case z3::check_result::sat:
 		{
@@ -128,6 +153,49 @@ void Z3CHCInterface::setSpacerOptions(bool _preProcessing)
 	p.set("fp.xform.inline_eager", _preProcessing);
 
 	m_solver.set(p);
+	m_preProcessing = _preProcessing;
+}
+
+unique_ptr<Z3CHCInterface> Z3CHCInterface::fork()
+{
+	auto copy = make_unique<Z3CHCInterface>(m_queryCache);
+	z3::context& target = *copy->m_context;
+	copy->m_z3Interface->importDeclarations(*m_z3Interface);
+	for (auto const& relation: m_relations)
+	{
+		z3::func_decl translated(target, Z3_to_func_decl(target, Z3_translate(*m_context, relation, target)));
+		copy->m_solver.register_relation(translated);
+		copy->m_relations.emplace_back(translated);
+	}
+	for (auto const& [rule, name]: m_rules)
+	{
+		z3::expr translated(target, Z3_translate(*m_context, rule, target));
+		copy->m_solver.add_rule(translated, target.str_symbol(name.c_str()));
+		copy->m_rules.emplace_back(translated, name);
+	}
+	copy->setSpacerOptions(m_preProcessing);
+	return copy;
+}
+
+SMTQueryCache::Query Z3CHCInterface::cacheQuery(z3::expr const& _query)
+{
+	set<string> symbols;
+	for (auto const& constant: m_z3Interface->constants())
+		symbols.insert(constant.first);
+	for (auto const& function: m_z3Interface->functions())
+		symbols.insert(function.first);
+	// The problem is printed from the relations and rules as they were added, because
+	// the output of the solver itself changes once it has answered a query.
+	string problem;
+	for (auto const& relation: m_relations)
+		problem += relation.to_string() + "\n";
+	for (auto const& [rule, name]: m_rules)
+		problem += "(rule " + rule.to_string() + " |" + name + "|)\n";
+	return SMTQueryCache::normalise(
+		problem + "(query " + _query.to_string() + ")\n",
+		symbols,
+		m_z3Interface->identifier() + " spacer" + (m_preProcessing ? " preprocessing" : "")
+	);
 }
 
 /**
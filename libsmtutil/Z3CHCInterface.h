@@ -23,6 +23,7 @@
 #pragma once
 
 #include <libsmtutil/CHCSolverInterface.h>
+#include <libsmtutil/SMTQueryCache.h>
 #include <libsmtutil/Z3Interface.h>
 
 #include <vector>
@@ -33,7 +34,8 @@ namespace solidity::smtutil
 class Z3CHCInterface: public CHCSolverInterface
 {
 public:
-	Z3CHCInterface();
+	/// @param _queryCache if given, query results are stored in and retrieved from it.
+	explicit Z3CHCInterface(SMTQueryCache* _queryCache = nullptr);
 
 	/// Forwards variable declaration to Z3Interface.
 	void declareVariable(std::string const& _name, SortPointer const& _sort) override;
@@ -48,7 +50,18 @@ public:
 
 	void setSpacerOptions(bool _preProcessing = true);
 
+	/// @returns an independent copy of the current Horn problem in a new Z3 context,
+	/// which can be queried on another thread.
+	/// Must be called on the thread that owns this interface.
+	std::unique_ptr<Z3CHCInterface> fork();
+
 private:
+	/// Runs the Horn solver on @a _query without consulting the cache.
+	std::pair<CheckResult, CexGraph> solve(z3::expr _query);
+
+	/// @returns the normalised form of the current Horn problem with query @a _query.
+	SMTQueryCache::Query cacheQuery(z3::expr const& _query);
+
 	/// Constructs a nonlinear counterexample graph from the refutation.
 	CHCSolverInterface::CexGraph cexGraph(z3::expr const& _proof);
 	/// @returns the fact from a proof node.
@@ -64,6 +77,14 @@ private:
 	z3::context* m_context;
 	// Horn solver.
 	z3::fixedpoint m_solver;
+
+	/// Registered relations and added rules, in order, so that the problem can be forked.
+	std::vector<z3::func_decl> m_relations;
+	std::vector<std::pair<z3::expr, std::string>> m_rules;
+
+	SMTQueryCache* m_queryCache = nullptr;
+	/// Whether Spacer's preprocessing is enabled, which influences the counterexamples.
+	bool m_preProcessing = true;
 };
 
 }
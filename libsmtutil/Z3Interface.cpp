@@ -35,6 +35,7 @@ void Z3Interface::reset()
 {
 	m_constants.clear();
 	m_functions.clear();
+	m_translations.clear();
 	m_solver.reset();
 }
 
@@ -54,7 +55,13 @@ void Z3Interface::declareVariable(string const& _name, SortPointer const& _sort)
 	if (_sort->kind == Kind::Function)
 		declareFunction(_name, *_sort);
 	else if (m_constants.count(_name))
-		m_constants.at(_name) = m_context.constant(_name.c_str(), z3Sort(*_sort));
+	{
+		z3::expr constant = m_context.constant(_name.c_str(), z3Sort(*_sort));
+		// Redeclaring with the same sort yields the same constant.
+		if (!z3::eq(constant, m_constants.at(_name)))
+			m_translations.clear();
+		m_constants.at(_name) = constant;
+	}
 	else
 		m_constants.emplace(_name, m_context.constant(_name.c_str(), z3Sort(*_sort)));
 }
@@ -64,11 +71,28 @@ void Z3Interface::declareFunction(string const& _name, Sort const& _sort)
 	smtAssert(_sort.kind == Kind::Function, "");
 	FunctionSort fSort = dynamic_cast<FunctionSort const&>(_sort);
 	if (m_functions.count(_name))
-		m_functions.at(_name) = m_context.function(_name.c_str(), z3Sort(fSort.domain), z3Sort(*fSort.codomain));
+	{
+		z3::func_decl function = m_context.function(_name.c_str(), z3Sort(fSort.domain), z3Sort(*fSort.codomain));
+		if (!z3::eq(function, m_functions.at(_name)))
+			m_translations.clear();
+		m_functions.at(_name) = function;
+	}
 	else
 		m_functions.emplace(_name, m_context.function(_name.c_str(), z3Sort(fSort.domain), z3Sort(*fSort.codomain)));
 }
 
+void Z3Interface::importDeclarations(Z3Interface& _other)
+{
+	for (auto const& [name, constant]: _other.m_constants)
+		m_constants.insert_or_assign(name, z3::expr(m_context, Z3_translate(_other.m_context, constant, m_context)));
+	for (auto const& [name, function]: _other.m_functions)
+	{
+		Z3_ast translated = Z3_translate(_other.m_context, function, m_context);
+		m_functions.insert_or_assign(name, z3::func_decl(m_context, Z3_to_func_decl(m_context, translated)));
+	}
+	m_translations.clear();
+}
+
 void Z3Interface::addAssertion(Expression const& _expr)
 {
 	m_solver.add(toZ3Expr(_expr));
@@ -109,7 +133,56 @@ pair<CheckResult, vector<string>> Z3Interface::check(vector<Expression> const& _
 	return make_pair(result, values);
 }
 
+void Z3Interface::interrupt()
+{
+	// The interruption only affects the query that is currently running,
+	// the context remains usable afterwards.
+	m_context.interrupt();
+}
+
+string Z3Interface::identifier() const
+{
+	return string("z3 ") + Z3_get_full_version() + " rlimit " + to_string(resourceLimit);
+}
+
 z3::expr Z3Interface::toZ3Expr(Expression const& _expr)
+{
+	// Leaves are cheap to translate and cannot be identified by their arguments.
+	if (_expr.arguments.empty())
+		return translate(_expr);
+
+	auto it = m_translations.find(_expr.arguments.storage());
+	if (
+		it != m_translations.end() &&
+		!it->second.node.expired() &&
+		it->second.name == _expr.name &&
+		it->second.sort == _expr.sort
+	)
+		return it->second.expr;
+
+	z3::expr result = translate(_expr);
+	storeTranslation(_expr, result);
+	return result;
+}
+
+void Z3Interface::storeTranslation(Expression const& _expr, z3::expr const& _translation)
+{
+	m_translations.insert_or_assign(
+		_expr.arguments.storage(),
+		Translation{_expr.arguments.weakStorage(), _expr.name, _expr.sort, _translation}
+	);
+	if (m_translations.size() < m_translationsPruneSize)
+		return;
+
+	for (auto it = m_translations.begin(); it != m_translations.end();)
+		if (it->second.node.expired())
+			it = m_translations.erase(it);
+		else
+			++it;
+	m_translationsPruneSize = max<size_t>(1024, 2 * m_translations.size());
+}
+
+z3::expr Z3Interface::translate(Expression const& _expr)
 {
 	if (_expr.arguments.empty() && m_constants.count(_expr.name))
 		return m_constants.at(_expr.name);
@@ -127,7 +200,7 @@ z3::expr Z3Interface::toZ3Expr(Expression const& _expr)
 			smtAssert(arguments.empty(), "");
 			return m_constants.at(n);
 		}
-		else if (arguments.empty())
+		else if (arguments.empty() && _expr.op() != Operator::TupleConstructor)
 		{
 			if (n == "true")
 				return m_context.bool_val(true);
@@ -151,66 +224,66 @@ z3::expr Z3Interface::toZ3Expr(Expression const& _expr)
 		}
 
 		smtAssert(_expr.hasCorrectArity(), "");
-		if (n == "ite")
+		if (_expr.op() == Operator::Ite)
 			return z3::ite(arguments[0], arguments[1], arguments[2]);
-		else if (n == "not")
+		else if (_expr.op() == Operator::Not)
 			return !arguments[0];
-		else if (n == "and")
+		else if (_expr.op() == Operator::And)
 			return arguments[0] && arguments[1];
-		else if (n == "or")
+		else if (_expr.op() == Operator::Or)
 			return arguments[0] || arguments[1];
-		else if (n == "implies")
+		else if (_expr.op() == Operator::Implies)
 			return z3::implies(arguments[0], arguments[1]);
-		else if (n == "=")
+		else if (_expr.op() == Operator::Equal)
 			return arguments[0] == arguments[1];
-		else if (n == "<")
+		else if (_expr.op() == Operator::Less)
 			return arguments[0] < arguments[1];
-		else if (n == "<=")
+		else if (_expr.op() == Operator::LessOrEqual)
 			return arguments[0] <= arguments[1];
-		else if (n == ">")
+		else if (_expr.op() == Operator::Greater)
 			return arguments[0] > arguments[1];
-		else if (n == ">=")
+		else if (_expr.op() == Operator::GreaterOrEqual)
 			return arguments[0] >= arguments[1];
-		else if (n == "+")
+		else if (_expr.op() == Operator::Add)
 			return arguments[0] + arguments[1];
-		else if (n == "-")
+		else if (_expr.op() == Operator::Sub)
 			return arguments[0] - arguments[1];
-		else if (n == "*")
+		else if (_expr.op() == Operator::Mul)
 			return arguments[0] * arguments[1];
-		else if (n == "/")
+		else if (_expr.op() == Operator::Div)
 			return arguments[0] / arguments[1];
-		else if (n == "mod")
+		else if (_expr.op() == Operator::Mod)
 			return z3::mod(arguments[0], arguments[1]);
-		else if (n == "bvnot")
+		else if (_expr.op() == Operator::BVNot)
 			return ~arguments[0];
-		else if (n == "bvand")
+		else if (_expr.op() == Operator::BVAnd)
 			return arguments[0] & arguments[1];
-		else if (n == "bvor")
+		else if (_expr.op() == Operator::BVOr)
 			return arguments[0] | arguments[1];
-		else if (n == "bvxor")
+		else if (_expr.op() == Operator::BVXor)
 			return arguments[0] ^ arguments[1];
-		else if (n == "bvshl")
+		else if (_expr.op() == Operator::BVShl)
 			return z3::shl(arguments[0], arguments[1]);
-		else if (n == "bvlshr")
+		else if (_expr.op() == Operator::BVLShr)
 			return z3::lshr(arguments[0], arguments[1]);
-		else if (n == "bvashr")
+		else if (_expr.op() == Operator::BVAShr)
 			return z3::ashr(arguments[0], arguments[1]);
-		else if (n == "int2bv")
+		else if (_expr.op() == Operator::Int2BV)
 		{
 			size_t size = std::stoul(_expr.arguments[1].name);
 			return z3::int2bv(size, arguments[0]);
 		}
-		else if (n == "bv2int")
+		else if (_expr.op() == Operator::BV2Int)
 		{
 			auto intSort = dynamic_pointer_cast<IntSort>(_expr.sort);
 			smtAssert(intSort, "");
 			return z3::bv2int(arguments[0], intSort->isSigned);
 		}
-		else if (n == "select")
+		else if (_expr.op() == Operator::Select)
 			return z3::select(arguments[0], arguments[1]);
-		else if (n == "store")
+		else if (_expr.op() == Operator::Store)
 			return z3::store(arguments[0], arguments[1], arguments[2]);
-		else if (n == "const_array")
+		else if (_expr.op() == Operator::ConstArray)
 		{
 			shared_ptr<SortSort> sortSort = std::dynamic_pointer_cast<SortSort>(_expr.arguments[0].sort);
 			smtAssert(sortSort, "");
@@ -218,12 +291,12 @@ z3::expr Z3Interface::toZ3Expr(Expression const& _expr)
 			smtAssert(arraySort && arraySort->domain, "");
 			return z3::const_array(z3Sort(*arraySort->domain), arguments[1]);
 		}
-		else if (n == "tuple_get")
+		else if (_expr.op() == Operator::TupleGet)
 		{
 			size_t index = stoul(_expr.arguments[1].name);
 			return z3::func_decl(m_context, Z3_get_tuple_sort_field_decl(m_context, z3Sort(*_expr.arguments[0].sort), index))(arguments[0]);
 		}
-		else if (n == "tuple_constructor")
+		else if (_expr.op() == Operator::TupleConstructor)
 		{
 			auto constructor = z3::func_decl(m_context, Z3_get_tuple_sort_mk_decl(m_context, z3Sort(*_expr.sort)));
 			smtAssert(constructor.arity() == arguments.size(), "");
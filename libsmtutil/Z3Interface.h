@@ -22,6 +22,8 @@
 #include <boost/noncopyable.hpp>
 #include <z3++.h>
 
+#include <unordered_map>
+
 namespace solidity::smtutil
 {
 
@@ -40,8 +42,16 @@ public:
 	void addAssertion(Expression const& _expr) override;
 	std::pair<CheckResult, std::vector<std::string>> check(std::vector<Expression> const& _expressionsToEvaluate) override;
 
+	void interrupt() override;
+
+	std::string identifier() const override;
+
 	z3::expr toZ3Expr(Expression const& _expr);
 
+	/// Declares all constants and functions of @a _other in this context.
+	/// Must not run concurrently with any use of @a _other.
+	void importDeclarations(Z3Interface& _other);
+
 	std::map<std::string, z3::expr> constants() const { return m_constants; }
 	std::map<std::string, z3::func_decl> functions() const { return m_functions; }
 
@@ -54,6 +64,10 @@ public:
 private:
 	void declareFunction(std::string const& _name, Sort const& _sort);
 
+	/// Translates @a _expr without looking up its own translation,
+	/// the arguments are translated via toZ3Expr.
+	z3::expr translate(Expression const& _expr);
+
 	z3::sort z3Sort(Sort const& _sort);
 	z3::sort_vector z3Sort(std::vector<SortPointer> const& _sorts);
 
@@ -62,6 +76,27 @@ private:
 
 	std::map<std::string, z3::expr> m_constants;
 	std::map<std::string, z3::func_decl> m_functions;
+
+	/// Translation of an expression node, see m_translations.
+	struct Translation
+	{
+		/// Expires with the node, after which its address can be reused.
+		std::weak_ptr<void const> node;
+		std::string name;
+		SortPointer sort;
+		z3::expr expr;
+	};
+
+	/// Adds the translation of @a _expr and removes those of expired nodes
+	/// whenever the number of entries doubled.
+	void storeTranslation(Expression const& _expr, z3::expr const& _translation);
+
+	/// Translations of the expressions that have arguments, keyed by the storage of
+	/// their arguments, which identifies a hash-consed expression node.
+	/// Cleared on reset and whenever a symbol is redeclared.
+	std::unordered_map<void const*, Translation> m_translations;
+	/// Size of m_translations at which expired entries are removed.
+	size_t m_translationsPruneSize = 1024;
 };
 
 }
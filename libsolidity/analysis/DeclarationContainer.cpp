@@ -40,10 +40,10 @@ Declaration const* DeclarationContainer::conflictingDeclaration(
 		_name = &_declaration.name();
 	solAssert(!_name->empty(), "");
 	vector<Declaration const*> declarations;
-	if (m_declarations.count(*_name))
-		declarations += m_declarations.at(*_name);
-	if (m_invisibleDeclarations.count(*_name))
-		declarations += m_invisibleDeclarations.at(*_name);
+	if (auto it = m_declarations.find(*_name); it != m_declarations.end())
+		declarations += it->second;
+	if (auto it = m_invisibleDeclarations.find(*_name); it != m_invisibleDeclarations.end())
+		declarations += it->second;
 
 	if (
 		dynamic_cast<FunctionDefinition const*>(&_declaration) ||
@@ -83,13 +83,15 @@ Declaration const* DeclarationContainer::conflictingDeclaration(
 
 void DeclarationContainer::activateVariable(ASTString const& _name)
 {
+	auto invisible = m_invisibleDeclarations.find(_name);
 	solAssert(
-		m_invisibleDeclarations.count(_name) && m_invisibleDeclarations.at(_name).size() == 1,
+		invisible != m_invisibleDeclarations.end() && invisible->second.size() == 1,
 		"Tried to activate a non-inactive variable or multiple inactive variables with the same name."
 	);
-	solAssert(m_declarations.count(_name) == 0 || m_declarations.at(_name).empty(), "");
-	m_declarations[_name].emplace_back(m_invisibleDeclarations.at(_name).front());
-	m_invisibleDeclarations.erase(_name);
+	vector<Declaration const*>& declarations = m_declarations[_name];
+	solAssert(declarations.empty(), "");
+	declarations.emplace_back(invisible->second.front());
+	m_invisibleDeclarations.erase(invisible);
 }
 
 bool DeclarationContainer::isInvisible(ASTString const& _name) const
@@ -148,12 +150,27 @@ vector<Declaration const*> DeclarationContainer::resolveName(ASTString const& _n
 {
 	solAssert(!_name.empty(), "Attempt to resolve empty name.");
 	vector<Declaration const*> result;
-	if (m_declarations.count(_name))
-		result = m_declarations.at(_name);
-	if (_alsoInvisible && m_invisibleDeclarations.count(_name))
-		result += m_invisibleDeclarations.at(_name);
-	if (result.empty() && _recursive && m_enclosingContainer)
-		result = m_enclosingContainer->resolveName(_name, true, _alsoInvisible);
+	// Walk up the scope chain iteratively, the name is hashed only once per container.
+	for (DeclarationContainer const* container = this; container; container = container->m_enclosingContainer)
+	{
+		if (auto it = container->m_declarations.find(_name); it != container->m_declarations.end())
+			result = it->second;
+		if (_alsoInvisible)
+			if (auto it = container->m_invisibleDeclarations.find(_name); it != container->m_invisibleDeclarations.end())
+				result += it->second;
+		if (!result.empty() || !_recursive)
+			break;
+	}
+	return result;
+}
+
+vector<DeclarationContainer::Declarations::value_type const*> DeclarationContainer::orderedDeclarations() const
+{
+	vector<Declarations::value_type const*> result;
+	result.reserve(m_declarations.size());
+	for (auto const& nameAndDeclarations: m_declarations)
+		result.emplace_back(&nameAndDeclarations);
+	sort(result.begin(), result.end(), [](auto const* _a, auto const* _b) { return _a->first < _b->first; });
 	return result;
 }
 
@@ -166,17 +183,21 @@ vector<ASTString> DeclarationContainer::similarNames(ASTString const& _name) con
 
 	vector<ASTString> similar;
 	size_t maximumEditDistance = _name.size() > 3 ? 2 : _name.size() / 2;
-	for (auto const& declaration: m_declarations)
+	for (auto const* declarations: {&m_declarations, &m_invisibleDeclarations})
 	{
-		string const& declarationName = declaration.first;
-		if (util::stringWithinDistance(_name, declarationName, maximumEditDistance, MAXIMUM_LENGTH_THRESHOLD))
-			similar.push_back(declarationName);
-	}
-	for (auto const& declaration: m_invisibleDeclarations)
-	{
-		string const& declarationName = declaration.first;
-		if (util::stringWithinDistance(_name, declarationName, maximumEditDistance, MAXIMUM_LENGTH_THRESHOLD))
-			similar.push_back(declarationName);
+		// Sort the matches of each table to keep the suggestions independent of the hashing.
+		size_t first = similar.size();
+		for (auto const& declaration: *declarations)
+		{
+			string const& declarationName = declaration.first;
+			// Names differing in length by more than the allowed distance cannot be similar.
+			if (
+				max(declarationName.size(), _name.size()) - min(declarationName.size(), _name.size()) <= maximumEditDistance &&
+				util::stringWithinDistance(_name, declarationName, maximumEditDistance, MAXIMUM_LENGTH_THRESHOLD)
+			)
+				similar.push_back(declarationName);
+		}
+		sort(similar.begin() + static_cast<ptrdiff_t>(first), similar.end());
 	}
 
 	if (m_enclosingContainer)
@@ -28,16 +28,22 @@
 #include <liblangutil/SourceLocation.h>
 #include <boost/noncopyable.hpp>
 
+#include <unordered_map>
+#include <vector>
+
 namespace solidity::frontend
 {
 
 /**
  * Container that stores mappings between names and declarations. It also contains a link to the
  * enclosing scope.
+ * Names are stored in hash tables, users that iterate over the declarations and whose
+ * results depend on the order have to use @a orderedDeclarations.
  */
 class DeclarationContainer
 {
 public:
+	using Declarations = std::unordered_map<ASTString, std::vector<Declaration const*>>;
 	using Homonyms = std::vector<std::pair<langutil::SourceLocation const*, std::vector<Declaration const*>>>;
 
 	explicit DeclarationContainer(
@@ -61,7 +67,9 @@ public:
 	std::vector<Declaration const*> resolveName(ASTString const& _name, bool _recursive = false, bool _alsoInvisible = false) const;
 	ASTNode const* enclosingNode() const { return m_enclosingNode; }
 	DeclarationContainer const* enclosingContainer() const { return m_enclosingContainer; }
-	std::map<ASTString, std::vector<Declaration const*>> const& declarations() const { return m_declarations; }
+	Declarations const& declarations() const { return m_declarations; }
+	/// @returns pointers to the elements of @a declarations(), sorted by name.
+	std::vector<Declarations::value_type const*> orderedDeclarations() const;
 	/// @returns whether declaration is valid, and if not also returns previous declaration.
 	Declaration const* conflictingDeclaration(Declaration const& _declaration, ASTString const* _name = nullptr) const;
 
@@ -84,8 +92,8 @@ private:
 	ASTNode const* m_enclosingNode;
 	DeclarationContainer const* m_enclosingContainer;
 	std::vector<DeclarationContainer const*> m_innerContainers;
-	std::map<ASTString, std::vector<Declaration const*>> m_declarations;
-	std::map<ASTString, std::vector<Declaration const*>> m_invisibleDeclarations;
+	Declarations m_declarations;
+	Declarations m_invisibleDeclarations;
 	/// List of declarations (name and location) to check later for homonymity.
 	std::vector<std::pair<std::string, langutil::SourceLocation const*>> m_homonymCandidates;
 };
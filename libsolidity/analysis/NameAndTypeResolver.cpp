@@ -115,14 +115,18 @@ bool NameAndTypeResolver::performImports(SourceUnit& _sourceUnit, map<string, So
 								error = true;
 				}
 			else if (imp->name().empty())
-				for (auto const& nameAndDeclaration: scope->second->declarations())
-					for (auto const& declaration: nameAndDeclaration.second)
+				for (auto const* nameAndDeclaration: scope->second->orderedDeclarations())
+					for (auto const& declaration: nameAndDeclaration->second)
 						if (!DeclarationRegistrationHelper::registerDeclaration(
-							target, *declaration, &nameAndDeclaration.first, &imp->location(), false, m_errorReporter
+							target, *declaration, &nameAndDeclaration->first, &imp->location(), false, m_errorReporter
 						))
 							error =  true;
 		}
-	_sourceUnit.annotation().exportedSymbols = m_scopes[&_sourceUnit]->declarations();
+	auto const& exportedSymbols = m_scopes[&_sourceUnit]->declarations();
+	_sourceUnit.annotation().exportedSymbols = map<ASTString, vector<Declaration const*>>(
+		exportedSymbols.begin(),
+		exportedSymbols.end()
+	);
 	return !error;
 }
 
@@ -346,8 +350,8 @@ void NameAndTypeResolver::importInheritedScope(ContractDefinition const& _base)
 {
 	auto iterator = m_scopes.find(&_base);
 	solAssert(iterator != end(m_scopes), "");
-	for (auto const& nameAndDeclaration: iterator->second->declarations())
-		for (auto const& declaration: nameAndDeclaration.second)
+	for (auto const* nameAndDeclaration: iterator->second->orderedDeclarations())
+		for (auto const& declaration: nameAndDeclaration->second)
 			// Import if it was declared in the base, is not the constructor and is visible in derived classes
 			if (declaration->scope() == &_base && declaration->isVisibleInDerivedContracts())
 				if (!m_currentScope->registerDeclaration(*declaration, false, false))
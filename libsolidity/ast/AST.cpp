@@ -46,9 +46,7 @@ ASTNode::ASTNode(int64_t _id, SourceLocation _location):
 
 ASTAnnotation& ASTNode::annotation() const
 {
-	if (!m_annotation)
-		m_annotation = make_unique<ASTAnnotation>();
-	return *m_annotation;
+	return initAnnotation<ASTAnnotation>();
 }
 
 SourceUnitAnnotation& SourceUnit::annotation() const
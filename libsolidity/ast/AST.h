@@ -23,6 +23,7 @@
 
 #pragma once
 
+#include <libsolidity/ast/ASTArena.h>
 #include <libsolidity/ast/ASTForward.h>
 #include <libsolidity/ast/Types.h>
 #include <libsolidity/ast/ASTAnnotations.h>
@@ -56,6 +57,18 @@ namespace solidity::frontend
 class ASTVisitor;
 class ASTConstVisitor;
 
+/// Deletes annotations, or only destroys them if they live in an ASTArena.
+struct ASTAnnotationDeleter
+{
+	bool inArena = false;
+	void operator()(ASTAnnotation* _annotation) const
+	{
+		if (inArena)
+			_annotation->~ASTAnnotation();
+		else
+			delete _annotation;
+	}
+};
 
 /**
  * The root (abstract) class of the AST inheritance tree.
@@ -125,6 +138,10 @@ public:
 	bool operator!=(ASTNode const& _other) const { return !operator==(_other); }
 	///@}
 
+	/// Sets the arena the node was allocated from, its annotation is allocated from it as well.
+	/// Used by the parser, the arena has to outlive the node.
+	void setArena(ASTArena* _arena) { m_arena = _arena; }
+
 protected:
 	size_t const m_id = 0;
 
@@ -132,13 +149,20 @@ protected:
 	T& initAnnotation() const
 	{
 		if (!m_annotation)
-			m_annotation = std::make_unique<T>();
+		{
+			if (m_arena)
+				m_annotation = {new (m_arena->allocate(sizeof(T), alignof(T))) T(), ASTAnnotationDeleter{true}};
+			else
+				m_annotation = {new T(), ASTAnnotationDeleter{false}};
+		}
 		return dynamic_cast<T&>(*m_annotation);
 	}
 
 private:
 	/// Annotation - is specialised in derived classes, is created upon request (because of polymorphism).
-	mutable std::unique_ptr<ASTAnnotation> m_annotation;
+	mutable std::unique_ptr<ASTAnnotation, ASTAnnotationDeleter> m_annotation;
+	/// Arena the node was allocated from, if any.
+	ASTArena* m_arena = nullptr;
 	SourceLocation m_location;
 };
 
@@ -243,7 +267,7 @@ public:
 	Declaration(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> _name,
+		ASTPointer<ASTString const> _name,
 		Visibility _visibility = Visibility::Default
 	):
 		ASTNode(_id, _location), m_name(std::move(_name)), m_visibility(_visibility) {}
@@ -286,7 +310,7 @@ protected:
 	virtual Visibility defaultVisibility() const { return Visibility::Public; }
 
 private:
-	ASTPointer<ASTString> m_name;
+	ASTPointer<ASTString const> m_name;
 	Visibility m_visibility;
 };
 
@@ -334,7 +358,7 @@ public:
 	struct SymbolAlias
 	{
 		ASTPointer<Identifier> symbol;
-		ASTPointer<ASTString> alias;
+		ASTPointer<ASTString const> alias;
 		SourceLocation location;
 	};
 
@@ -343,8 +367,8 @@ public:
 	ImportDirective(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> _path,
-		ASTPointer<ASTString> const& _unitAlias,
+		ASTPointer<ASTString const> _path,
+		ASTPointer<ASTString const> const& _unitAlias,
 		SymbolAliasList _symbolAliases
 	):
 		Declaration(_id, _location, _unitAlias),
@@ -365,7 +389,7 @@ public:
 	TypePointer type() const override;
 
 private:
-	ASTPointer<ASTString> m_path;
+	ASTPointer<ASTString const> m_path;
 	/// The aliases for the specific symbols to import. If non-empty import the specific symbols.
 	/// If the `alias` component is empty, import the identifier unchanged.
 	/// If both m_unitAlias and m_symbolAlias are empty, import all symbols into the current scope.
@@ -397,7 +421,7 @@ public:
 	StructuredDocumentation(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> _text
+		ASTPointer<ASTString const> _text
 	): ASTNode(_id, _location), m_text(std::move(_text))
 	{}
 
@@ -406,10 +430,10 @@ public:
 
 	/// @return A shared pointer of an ASTString.
 	/// Contains doxygen-style, structured documentation that is parsed later on.
-	ASTPointer<ASTString> const& text() const { return m_text; }
+	ASTPointer<ASTString const> const& text() const { return m_text; }
 
 private:
-	ASTPointer<ASTString> m_text;
+	ASTPointer<ASTString const> m_text;
 };
 
 /**
@@ -419,14 +443,14 @@ class Documented
 {
 public:
 	virtual ~Documented() = default;
-	explicit Documented(ASTPointer<ASTString> _documentation): m_documentation(std::move(_documentation)) {}
+	explicit Documented(ASTPointer<ASTString const> _documentation): m_documentation(std::move(_documentation)) {}
 
 	/// @return A shared pointer of an ASTString.
 	/// Can contain a nullptr in which case indicates absence of documentation
-	ASTPointer<ASTString> const& documentation() const { return m_documentation; }
+	ASTPointer<ASTString const> const& documentation() const { return m_documentation; }
 
 protected:
-	ASTPointer<ASTString> m_documentation;
+	ASTPointer<ASTString const> m_documentation;
 };
 
 /**
@@ -476,7 +500,7 @@ public:
 	ContractDefinition(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _name,
+		ASTPointer<ASTString const> const& _name,
 		ASTPointer<StructuredDocumentation> const& _documentation,
 		std::vector<ASTPointer<InheritanceSpecifier>> _baseContracts,
 		std::vector<ASTPointer<ASTNode>> _subNodes,
@@ -622,7 +646,7 @@ public:
 	StructDefinition(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _name,
+		ASTPointer<ASTString const> const& _name,
 		std::vector<ASTPointer<VariableDeclaration>> _members
 	):
 		Declaration(_id, _location, _name), m_members(std::move(_members)) {}
@@ -649,7 +673,7 @@ public:
 	EnumDefinition(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _name,
+		ASTPointer<ASTString const> const& _name,
 		std::vector<ASTPointer<EnumValue>> _members
 	):
 		Declaration(_id, _location, _name), m_members(std::move(_members)) {}
@@ -675,7 +699,7 @@ private:
 class EnumValue: public Declaration
 {
 public:
-	EnumValue(int64_t _id, SourceLocation const& _location, ASTPointer<ASTString> const& _name):
+	EnumValue(int64_t _id, SourceLocation const& _location, ASTPointer<ASTString const> const& _name):
 		Declaration(_id, _location, _name) {}
 
 	void accept(ASTVisitor& _visitor) override;
@@ -717,7 +741,7 @@ public:
 	CallableDeclaration(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _name,
+		ASTPointer<ASTString const> const& _name,
 		Visibility _visibility,
 		ASTPointer<ParameterList> _parameters,
 		bool _isVirtual = false,
@@ -794,7 +818,7 @@ public:
 	FunctionDefinition(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _name,
+		ASTPointer<ASTString const> const& _name,
 		Visibility _visibility,
 		StateMutability _stateMutability,
 		bool _free,
@@ -907,7 +931,7 @@ public:
 		int64_t _id,
 		SourceLocation const& _location,
 		ASTPointer<TypeName> _type,
-		ASTPointer<ASTString> const& _name,
+		ASTPointer<ASTString const> const& _name,
 		ASTPointer<Expression> _value,
 		Visibility _visibility,
 		ASTPointer<StructuredDocumentation> const _documentation = nullptr,
@@ -1012,7 +1036,7 @@ public:
 	ModifierDefinition(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _name,
+		ASTPointer<ASTString const> const& _name,
 		ASTPointer<StructuredDocumentation> const& _documentation,
 		ASTPointer<ParameterList> const& _parameters,
 		bool _isVirtual,
@@ -1087,7 +1111,7 @@ public:
 	EventDefinition(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _name,
+		ASTPointer<ASTString const> const& _name,
 		ASTPointer<StructuredDocumentation> const& _documentation,
 		ASTPointer<ParameterList> const& _parameters,
 		bool _anonymous = false
@@ -1319,7 +1343,7 @@ public:
 	explicit Statement(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _docString
+		ASTPointer<ASTString const> const& _docString
 	): ASTNode(_id, _location), Documented(_docString) {}
 
 	StatementAnnotation& annotation() const override;
@@ -1334,7 +1358,7 @@ public:
 	InlineAssembly(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _docString,
+		ASTPointer<ASTString const> const& _docString,
 		yul::Dialect const& _dialect,
 		std::shared_ptr<yul::Block> _operations
 	):
@@ -1361,7 +1385,7 @@ public:
 	Block(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _docString,
+		ASTPointer<ASTString const> const& _docString,
 		std::vector<ASTPointer<Statement>> _statements
 	):
 		Statement(_id, _location, _docString), m_statements(std::move(_statements)) {}
@@ -1386,7 +1410,7 @@ public:
 	explicit PlaceholderStatement(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _docString
+		ASTPointer<ASTString const> const& _docString
 	): Statement(_id, _location, _docString) {}
 
 	void accept(ASTVisitor& _visitor) override;
@@ -1403,7 +1427,7 @@ public:
 	IfStatement(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _docString,
+		ASTPointer<ASTString const> const& _docString,
 		ASTPointer<Expression> _condition,
 		ASTPointer<Statement> _trueBody,
 		ASTPointer<Statement> _falseBody
@@ -1438,7 +1462,7 @@ public:
 	TryCatchClause(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> _errorName,
+		ASTPointer<ASTString const> _errorName,
 		ASTPointer<ParameterList> _parameters,
 		ASTPointer<Block> _block
 	):
@@ -1457,7 +1481,7 @@ public:
 	TryCatchClauseAnnotation& annotation() const override;
 
 private:
-	ASTPointer<ASTString> m_errorName;
+	ASTPointer<ASTString const> m_errorName;
 	ASTPointer<ParameterList> m_parameters;
 	ASTPointer<Block> m_block;
 };
@@ -1482,7 +1506,7 @@ public:
 	TryStatement(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _docString,
+		ASTPointer<ASTString const> const& _docString,
 		ASTPointer<Expression> _externalCall,
 		std::vector<ASTPointer<TryCatchClause>> _clauses
 	):
@@ -1514,7 +1538,7 @@ public:
 	explicit BreakableStatement(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _docString
+		ASTPointer<ASTString const> const& _docString
 	): Statement(_id, _location, _docString) {}
 };
 
@@ -1524,7 +1548,7 @@ public:
 	WhileStatement(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _docString,
+		ASTPointer<ASTString const> const& _docString,
 		ASTPointer<Expression> _condition,
 		ASTPointer<Statement> _body,
 		bool _isDoWhile
@@ -1553,7 +1577,7 @@ public:
 	ForStatement(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _docString,
+		ASTPointer<ASTString const> const& _docString,
 		ASTPointer<Statement> _initExpression,
 		ASTPointer<Expression> _conditionExpression,
 		ASTPointer<ExpressionStatement> _loopExpression,
@@ -1589,7 +1613,7 @@ private:
 class Continue: public Statement
 {
 public:
-	explicit Continue(int64_t _id, SourceLocation const& _location, ASTPointer<ASTString> const& _docString):
+	explicit Continue(int64_t _id, SourceLocation const& _location, ASTPointer<ASTString const> const& _docString):
 		Statement(_id, _location, _docString) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
@@ -1598,7 +1622,7 @@ public:
 class Break: public Statement
 {
 public:
-	explicit Break(int64_t _id, SourceLocation const& _location, ASTPointer<ASTString> const& _docString):
+	explicit Break(int64_t _id, SourceLocation const& _location, ASTPointer<ASTString const> const& _docString):
 		Statement(_id, _location, _docString) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
@@ -1610,7 +1634,7 @@ public:
 	Return(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _docString,
+		ASTPointer<ASTString const> const& _docString,
 		ASTPointer<Expression> _expression
 	): Statement(_id, _location, _docString), m_expression(std::move(_expression)) {}
 	void accept(ASTVisitor& _visitor) override;
@@ -1630,7 +1654,7 @@ private:
 class Throw: public Statement
 {
 public:
-	explicit Throw(int64_t _id, SourceLocation const& _location, ASTPointer<ASTString> const& _docString):
+	explicit Throw(int64_t _id, SourceLocation const& _location, ASTPointer<ASTString const> const& _docString):
 		Statement(_id, _location, _docString) {}
 	void accept(ASTVisitor& _visitor) override;
 	void accept(ASTConstVisitor& _visitor) const override;
@@ -1645,7 +1669,7 @@ public:
 	explicit EmitStatement(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _docString,
+		ASTPointer<ASTString const> const& _docString,
 		ASTPointer<FunctionCall> _functionCall
 	):
 		Statement(_id, _location, _docString), m_eventCall(std::move(_functionCall)) {}
@@ -1672,7 +1696,7 @@ public:
 	VariableDeclarationStatement(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _docString,
+		ASTPointer<ASTString const> const& _docString,
 		std::vector<ASTPointer<VariableDeclaration>> _variables,
 		ASTPointer<Expression> _initialValue
 	):
@@ -1702,7 +1726,7 @@ public:
 	ExpressionStatement(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> const& _docString,
+		ASTPointer<ASTString const> const& _docString,
 		ASTPointer<Expression> _expression
 	):
 		Statement(_id, _location, _docString), m_expression(std::move(_expression)) {}
@@ -1902,7 +1926,7 @@ public:
 		SourceLocation const& _location,
 		ASTPointer<Expression> _expression,
 		std::vector<ASTPointer<Expression>> _arguments,
-		std::vector<ASTPointer<ASTString>> _names
+		std::vector<ASTPointer<ASTString const>> _names
 	):
 		Expression(_id, _location), m_expression(std::move(_expression)), m_arguments(std::move(_arguments)), m_names(std::move(_names)) {}
 	void accept(ASTVisitor& _visitor) override;
@@ -1910,14 +1934,14 @@ public:
 
 	Expression const& expression() const { return *m_expression; }
 	std::vector<ASTPointer<Expression const>> arguments() const { return {m_arguments.begin(), m_arguments.end()}; }
-	std::vector<ASTPointer<ASTString>> const& names() const { return m_names; }
+	std::vector<ASTPointer<ASTString const>> const& names() const { return m_names; }
 
 	FunctionCallAnnotation& annotation() const override;
 
 private:
 	ASTPointer<Expression> m_expression;
 	std::vector<ASTPointer<Expression>> m_arguments;
-	std::vector<ASTPointer<ASTString>> m_names;
+	std::vector<ASTPointer<ASTString const>> m_names;
 };
 
 /**
@@ -1932,7 +1956,7 @@ public:
 		SourceLocation const& _location,
 		ASTPointer<Expression> _expression,
 		std::vector<ASTPointer<Expression>> _options,
-		std::vector<ASTPointer<ASTString>> _names
+		std::vector<ASTPointer<ASTString const>> _names
 	):
 		Expression(_id, _location), m_expression(std::move(_expression)), m_options(std::move(_options)), m_names(std::move(_names)) {}
 	void accept(ASTVisitor& _visitor) override;
@@ -1940,12 +1964,12 @@ public:
 
 	Expression const& expression() const { return *m_expression; }
 	std::vector<ASTPointer<Expression const>> options() const { return {m_options.begin(), m_options.end()}; }
-	std::vector<ASTPointer<ASTString>> const& names() const { return m_names; }
+	std::vector<ASTPointer<ASTString const>> const& names() const { return m_names; }
 
 private:
 	ASTPointer<Expression> m_expression;
 	std::vector<ASTPointer<Expression>> m_options;
-	std::vector<ASTPointer<ASTString>> m_names;
+	std::vector<ASTPointer<ASTString const>> m_names;
 
 };
 
@@ -1981,7 +2005,7 @@ public:
 		int64_t _id,
 		SourceLocation const& _location,
 		ASTPointer<Expression> _expression,
-		ASTPointer<ASTString> _memberName
+		ASTPointer<ASTString const> _memberName
 	):
 		Expression(_id, _location), m_expression(std::move(_expression)), m_memberName(std::move(_memberName)) {}
 	void accept(ASTVisitor& _visitor) override;
@@ -1993,7 +2017,7 @@ public:
 
 private:
 	ASTPointer<Expression> m_expression;
-	ASTPointer<ASTString> m_memberName;
+	ASTPointer<ASTString const> m_memberName;
 };
 
 /**
@@ -2066,7 +2090,7 @@ public:
 	Identifier(
 		int64_t _id,
 		SourceLocation const& _location,
-		ASTPointer<ASTString> _name
+		ASTPointer<ASTString const> _name
 	):
 		PrimaryExpression(_id, _location), m_name(std::move(_name)) {}
 	void accept(ASTVisitor& _visitor) override;
@@ -2077,7 +2101,7 @@ public:
 	IdentifierAnnotation& annotation() const override;
 
 private:
-	ASTPointer<ASTString> m_name;
+	ASTPointer<ASTString const> m_name;
 };
 
 /**
@@ -2129,7 +2153,7 @@ public:
 		int64_t _id,
 		SourceLocation const& _location,
 		Token _token,
-		ASTPointer<ASTString> _value,
+		ASTPointer<ASTString const> _value,
 		SubDenomination _sub = SubDenomination::None
 	):
 		PrimaryExpression(_id, _location), m_token(_token), m_value(std::move(_value)), m_subDenomination(_sub) {}
@@ -2156,7 +2180,7 @@ public:
 
 private:
 	Token m_token;
-	ASTPointer<ASTString> m_value;
+	ASTPointer<ASTString const> m_value;
 	SubDenomination m_subDenomination;
 };
 
@@ -0,0 +1,51 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolidity/ast/ASTArena.h>
+
+#include <liblangutil/Exceptions.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::frontend;
+
+void* ASTArena::allocate(size_t _size, size_t _alignment)
+{
+	solAssert(_alignment > 0 && (_alignment & (_alignment - 1)) == 0, "");
+
+	void* position = m_position;
+	if (!position || !align(_alignment, _size, position, m_remaining))
+	{
+		// Large allocations get their own block, so that the current block can still be filled.
+		size_t blockSize = _size + _alignment > c_blockSize / 4 ? _size + _alignment : c_blockSize;
+		// The memory does not need to be zeroed.
+		m_blocks.emplace_back(new byte[blockSize]);
+		void* block = m_blocks.back().get();
+		size_t space = blockSize;
+		void* result = align(_alignment, _size, block, space);
+		solAssert(result, "");
+		if (blockSize != c_blockSize)
+			return result;
+		position = result;
+		m_remaining = space;
+	}
+
+	m_position = static_cast<byte*>(position) + _size;
+	m_remaining -= _size;
+	return position;
+}
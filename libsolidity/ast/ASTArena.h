@@ -0,0 +1,83 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Arena for the nodes and annotations of a source unit.
+ */
+
+#pragma once
+
+#include <boost/noncopyable.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace solidity::frontend
+{
+
+/**
+ * Bump allocator from which the parser allocates the nodes of a source unit
+ * and the nodes allocate their annotations, so that they end up close together in memory.
+ *
+ * Memory is never given back individually, it is released as a whole when the arena is destroyed.
+ * Nodes are allocated via ASTArenaAllocator, whose copies (stored in the control blocks of the
+ * node pointers) keep the arena alive as long as any of its nodes exists.
+ *
+ * Allocation is not synchronised: every arena belongs to the Parser run of a single source unit,
+ * and the nodes and annotations of a source unit are only created on one thread.
+ */
+class ASTArena: private boost::noncopyable
+{
+public:
+	/// @returns @a _size bytes of uninitialised memory aligned to @a _alignment.
+	void* allocate(size_t _size, size_t _alignment);
+
+private:
+	static size_t constexpr c_blockSize = 64 * 1024;
+
+	std::vector<std::unique_ptr<std::byte[]>> m_blocks;
+	std::byte* m_position = nullptr;
+	size_t m_remaining = 0;
+};
+
+/// Standard allocator that allocates from an ASTArena, to be used with std::allocate_shared.
+template <class T>
+class ASTArenaAllocator
+{
+public:
+	using value_type = T;
+
+	explicit ASTArenaAllocator(std::shared_ptr<ASTArena> _arena): m_arena(std::move(_arena)) {}
+	template <class U>
+	ASTArenaAllocator(ASTArenaAllocator<U> const& _other): m_arena(_other.arena()) {}
+
+	T* allocate(size_t _count) { return static_cast<T*>(m_arena->allocate(_count * sizeof(T), alignof(T))); }
+	void deallocate(T*, size_t) noexcept {}
+
+	std::shared_ptr<ASTArena> const& arena() const { return m_arena; }
+
+	template <class U>
+	bool operator==(ASTArenaAllocator<U> const& _other) const { return m_arena == _other.arena(); }
+	template <class U>
+	bool operator!=(ASTArenaAllocator<U> const& _other) const { return m_arena != _other.arena(); }
+
+private:
+	std::shared_ptr<ASTArena> m_arena;
+};
+
+}
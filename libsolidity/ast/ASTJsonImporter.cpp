@@ -56,10 +56,9 @@ ASTPointer<T> ASTJsonImporter::nullOrCast(Json::Value const& _json)
 
 map<string, ASTPointer<SourceUnit>> ASTJsonImporter::jsonToSourceUnit(map<string, Json::Value> const& _sourceList)
 {
-	m_sourceList = _sourceList;
 	for (auto const& src: _sourceList)
 		m_sourceLocations.emplace_back(make_shared<string const>(src.first));
-	for (auto const& srcPair: m_sourceList)
+	for (auto const& srcPair: _sourceList)
 	{
 		astAssert(!srcPair.second.isNull(), "");
 		astAssert(member(srcPair.second,"nodeType") == "SourceUnit", "The 'nodeType' of the highest node must be 'SourceUnit'.");
@@ -105,114 +104,82 @@ ASTPointer<T> ASTJsonImporter::convertJsonToASTNode(Json::Value const& _node)
 }
 
 
+namespace
+{
+
+/// Calls the member function @a _create of the importer, which creates a node of a specific type.
+template <auto _create>
+ASTPointer<ASTNode> createNode(ASTJsonImporter& _importer, Json::Value const& _node)
+{
+	return (_importer.*_create)(_node);
+}
+
+}
+
 ASTPointer<ASTNode> ASTJsonImporter::convertJsonToASTNode(Json::Value const& _json)
 {
-	astAssert(_json["nodeType"].isString() && _json.isMember("id"), "JSON-Node needs to have 'nodeType' and 'id' fields.");
-	string nodeType = _json["nodeType"].asString();
-	if (nodeType == "PragmaDirective")
-		return createPragmaDirective(_json);
-	if (nodeType == "ImportDirective")
-		return createImportDirective(_json);
-	if (nodeType == "ContractDefinition")
-		return createContractDefinition(_json);
-	if (nodeType == "InheritanceSpecifier")
-		return createInheritanceSpecifier(_json);
-	if (nodeType == "UsingForDirective")
-		return createUsingForDirective(_json);
-	if (nodeType == "StructDefinition")
-		return createStructDefinition(_json);
-	if (nodeType == "EnumDefinition")
-		return createEnumDefinition(_json);
-	if (nodeType == "EnumValue")
-		return createEnumValue(_json);
-	if (nodeType == "ParameterList")
-		return createParameterList(_json);
-	if (nodeType == "OverrideSpecifier")
-		return createOverrideSpecifier(_json);
-	if (nodeType == "FunctionDefinition")
-		return createFunctionDefinition(_json);
-	if (nodeType == "VariableDeclaration")
-		return createVariableDeclaration(_json);
-	if (nodeType == "ModifierDefinition")
-		return createModifierDefinition(_json);
-	if (nodeType == "ModifierInvocation")
-		return createModifierInvocation(_json);
-	if (nodeType == "EventDefinition")
-		return createEventDefinition(_json);
-	if (nodeType == "ElementaryTypeName")
-		return createElementaryTypeName(_json);
-	if (nodeType == "UserDefinedTypeName")
-		return createUserDefinedTypeName(_json);
-	if (nodeType == "FunctionTypeName")
-		return createFunctionTypeName(_json);
-	if (nodeType == "Mapping")
-		return createMapping(_json);
-	if (nodeType == "ArrayTypeName")
-		return createArrayTypeName(_json);
-	if (nodeType == "InlineAssembly")
-		return createInlineAssembly(_json);
-	if (nodeType == "Block")
-		return createBlock(_json);
-	if (nodeType == "PlaceholderStatement")
-		return createPlaceholderStatement(_json);
-	if (nodeType == "IfStatement")
-		return createIfStatement(_json);
-	if (nodeType == "TryCatchClause")
-		return createTryCatchClause(_json);
-	if (nodeType == "TryStatement")
-		return createTryStatement(_json);
-	if (nodeType == "WhileStatement")
-		return createWhileStatement(_json, false);
-	if (nodeType == "DoWhileStatement")
-		return createWhileStatement(_json, true);
-	if (nodeType == "ForStatement")
-		return createForStatement(_json);
-	if (nodeType == "Continue")
-		return createContinue(_json);
-	if (nodeType == "Break")
-		return createBreak(_json);
-	if (nodeType == "Return")
-		return createReturn(_json);
-	if (nodeType == "EmitStatement")
-		return createEmitStatement(_json);
-	if (nodeType == "Throw")
-		return createThrow(_json);
-	if (nodeType == "VariableDeclarationStatement")
-		return createVariableDeclarationStatement(_json);
-	if (nodeType == "ExpressionStatement")
-		return createExpressionStatement(_json);
-	if (nodeType == "Conditional")
-		return createConditional(_json);
-	if (nodeType == "Assignment")
-		return createAssignment(_json);
-	if (nodeType == "TupleExpression")
-		return createTupleExpression(_json);
-	if (nodeType == "UnaryOperation")
-		return createUnaryOperation(_json);
-	if (nodeType == "BinaryOperation")
-		return createBinaryOperation(_json);
-	if (nodeType == "FunctionCall")
-		return createFunctionCall(_json);
-	if (nodeType == "FunctionCallOptions")
-		return createFunctionCallOptions(_json);
-	if (nodeType == "NewExpression")
-		return createNewExpression(_json);
-	if (nodeType == "MemberAccess")
-		return createMemberAccess(_json);
-	if (nodeType == "IndexAccess")
-		return createIndexAccess(_json);
-	if (nodeType == "IndexRangeAccess")
-		return createIndexRangeAccess(_json);
-	if (nodeType == "Identifier")
-		return createIdentifier(_json);
-	if (nodeType == "ElementaryTypeNameExpression")
-		return createElementaryTypeNameExpression(_json);
-	if (nodeType == "Literal")
-		return createLiteral(_json);
-	if (nodeType == "StructuredDocumentation")
-		return createDocumentation(_json);
-	else
-		astAssert(false, "Unknown type of ASTNode: " + nodeType);
+	using NodeCreator = ASTPointer<ASTNode>(*)(ASTJsonImporter&, Json::Value const&);
+#define SOL_NODE_CREATOR(NodeType) {#NodeType, &createNode<&ASTJsonImporter::create##NodeType>}
+	static unordered_map<string, NodeCreator> const nodeCreators{
+		SOL_NODE_CREATOR(PragmaDirective),
+		SOL_NODE_CREATOR(ImportDirective),
+		SOL_NODE_CREATOR(ContractDefinition),
+		SOL_NODE_CREATOR(InheritanceSpecifier),
+		SOL_NODE_CREATOR(UsingForDirective),
+		SOL_NODE_CREATOR(StructDefinition),
+		SOL_NODE_CREATOR(EnumDefinition),
+		SOL_NODE_CREATOR(EnumValue),
+		SOL_NODE_CREATOR(ParameterList),
+		SOL_NODE_CREATOR(OverrideSpecifier),
+		SOL_NODE_CREATOR(FunctionDefinition),
+		SOL_NODE_CREATOR(VariableDeclaration),
+		SOL_NODE_CREATOR(ModifierDefinition),
+		SOL_NODE_CREATOR(ModifierInvocation),
+		SOL_NODE_CREATOR(EventDefinition),
+		SOL_NODE_CREATOR(ElementaryTypeName),
+		SOL_NODE_CREATOR(UserDefinedTypeName),
+		SOL_NODE_CREATOR(FunctionTypeName),
+		SOL_NODE_CREATOR(Mapping),
+		SOL_NODE_CREATOR(ArrayTypeName),
+		SOL_NODE_CREATOR(InlineAssembly),
+		SOL_NODE_CREATOR(Block),
+		SOL_NODE_CREATOR(PlaceholderStatement),
+		SOL_NODE_CREATOR(IfStatement),
+		SOL_NODE_CREATOR(TryCatchClause),
+		SOL_NODE_CREATOR(TryStatement),
+		{"WhileStatement", [](ASTJsonImporter& _importer, Json::Value const& _node) -> ASTPointer<ASTNode> { return _importer.createWhileStatement(_node, false); }},
+		{"DoWhileStatement", [](ASTJsonImporter& _importer, Json::Value const& _node) -> ASTPointer<ASTNode> { return _importer.createWhileStatement(_node, true); }},
+		SOL_NODE_CREATOR(ForStatement),
+		SOL_NODE_CREATOR(Continue),
+		SOL_NODE_CREATOR(Break),
+		SOL_NODE_CREATOR(Return),
+		SOL_NODE_CREATOR(EmitStatement),
+		SOL_NODE_CREATOR(Throw),
+		SOL_NODE_CREATOR(VariableDeclarationStatement),
+		SOL_NODE_CREATOR(ExpressionStatement),
+		SOL_NODE_CREATOR(Conditional),
+		SOL_NODE_CREATOR(Assignment),
+		SOL_NODE_CREATOR(TupleExpression),
+		SOL_NODE_CREATOR(UnaryOperation),
+		SOL_NODE_CREATOR(BinaryOperation),
+		SOL_NODE_CREATOR(FunctionCall),
+		SOL_NODE_CREATOR(FunctionCallOptions),
+		SOL_NODE_CREATOR(NewExpression),
+		SOL_NODE_CREATOR(MemberAccess),
+		SOL_NODE_CREATOR(IndexAccess),
+		SOL_NODE_CREATOR(IndexRangeAccess),
+		SOL_NODE_CREATOR(Identifier),
+		SOL_NODE_CREATOR(ElementaryTypeNameExpression),
+		SOL_NODE_CREATOR(Literal),
+		{"StructuredDocumentation", &createNode<&ASTJsonImporter::createDocumentation>}
+	};
+#undef SOL_NODE_CREATOR
+
+	Json::Value const& nodeType = member(_json, "nodeType");
+	astAssert(nodeType.isString() && _json.isMember("id"), "JSON-Node needs to have 'nodeType' and 'id' fields.");
+	auto creator = nodeCreators.find(nodeType.asString());
+	astAssert(creator != nodeCreators.end(), "Unknown type of ASTNode: " + nodeType.asString());
+	return creator->second(*this, _json);
 }
 
 // ============ functions to instantiate the AST-Nodes from Json-Nodes ==============
@@ -247,8 +214,8 @@ ASTPointer<PragmaDirective> ASTJsonImporter::createPragmaDirective(Json::Value c
 
 ASTPointer<ImportDirective> ASTJsonImporter::createImportDirective(Json::Value const& _node)
 {
-	ASTPointer<ASTString> unitAlias = memberAsASTString(_node, "unitAlias");
-	ASTPointer<ASTString> path = memberAsASTString(_node, "file");
+	ASTPointer<ASTString const> unitAlias = memberAsASTString(_node, "unitAlias");
+	ASTPointer<ASTString const> path = memberAsASTString(_node, "file");
 	ImportDirective::SymbolAliasList symbolAliases;
 
 	for (auto& tuple: member(_node, "symbolAliases"))
@@ -778,7 +745,7 @@ ASTPointer<FunctionCall> ASTJsonImporter::createFunctionCall(Json::Value const&
 	std::vector<ASTPointer<Expression>> arguments;
 	for (auto& arg: member(_node, "arguments"))
 		arguments.push_back(convertJsonToASTNode<Expression>(arg));
-	std::vector<ASTPointer<ASTString>> names;
+	std::vector<ASTPointer<ASTString const>> names;
 	for (auto& name: member(_node, "names"))
 	{
 		astAssert(name.isString(), "Expected 'names' members to be strings!");
@@ -797,7 +764,7 @@ ASTPointer<FunctionCallOptions> ASTJsonImporter::createFunctionCallOptions(Json:
 	std::vector<ASTPointer<Expression>> options;
 	for (auto& option: member(_node, "options"))
 		options.push_back(convertJsonToASTNode<Expression>(option));
-	std::vector<ASTPointer<ASTString>> names;
+	std::vector<ASTPointer<ASTString const>> names;
 	for (auto& name: member(_node, "names"))
 	{
 		astAssert(name.isString(), "Expected 'names' members to be strings!");
@@ -868,7 +835,7 @@ ASTPointer<ASTNode> ASTJsonImporter::createLiteral(Json::Value const&  _node)
 
 	astAssert(member(_node, valStr).isString() || member(_node, hexValStr).isString(), "Literal-value is unset.");
 
-	ASTPointer<ASTString> value = _node.isMember(hexValStr) ?
+	ASTPointer<ASTString const> value = _node.isMember(hexValStr) ?
 		make_shared<ASTString>(util::asString(util::fromHex(_node[hexValStr].asString()))) :
 		make_shared<ASTString>(_node[valStr].asString());
 
@@ -894,11 +861,11 @@ ASTPointer<StructuredDocumentation> ASTJsonImporter::createDocumentation(Json::V
 
 // ===== helper functions ==========
 
-Json::Value ASTJsonImporter::member(Json::Value const& _node, string const& _name)
+Json::Value const& ASTJsonImporter::member(Json::Value const& _node, string const& _name)
 {
-	if (!_node.isMember(_name))
-		return Json::nullValue;
-	return _node[_name];
+	// Returning a reference avoids copying the whole subtree for every access.
+	Json::Value const* value = _node.find(_name.data(), _name.data() + _name.size());
+	return value ? *value : Json::Value::nullSingleton();
 }
 
 Token ASTJsonImporter::scanSingleToken(Json::Value const& _node)
@@ -908,23 +875,23 @@ Token ASTJsonImporter::scanSingleToken(Json::Value const& _node)
 	return scanner.currentToken();
 }
 
-ASTPointer<ASTString> ASTJsonImporter::nullOrASTString(Json::Value const& _json, string const& _name)
+ASTPointer<ASTString const> ASTJsonImporter::nullOrASTString(Json::Value const& _json, string const& _name)
 {
 	return _json[_name].isString() ? memberAsASTString(_json, _name) : nullptr;
 }
 
-ASTPointer<ASTString> ASTJsonImporter::memberAsASTString(Json::Value const& _node, string const& _name)
+ASTPointer<ASTString const> ASTJsonImporter::memberAsASTString(Json::Value const& _node, string const& _name)
 {
-	Json::Value value = member(_node, _name);
+	Json::Value const& value = member(_node, _name);
 	astAssert(value.isString(), "field " + _name + " must be of type string.");
-	return make_shared<ASTString>(_node[_name].asString());
+	return make_shared<ASTString>(value.asString());
 }
 
 bool ASTJsonImporter::memberAsBool(Json::Value const& _node, string const& _name)
 {
-	Json::Value value = member(_node, _name);
+	Json::Value const& value = member(_node, _name);
 	astAssert(value.isBool(), "field " + _name + " must be of type boolean.");
-	return _node[_name].asBool();
+	return value.asBool();
 }
 
 
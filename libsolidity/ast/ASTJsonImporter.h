@@ -125,19 +125,19 @@ private:
 
 	// =============== general helper functions ===================
 	/// @returns the member of a given JSON object, throws if member does not exist
-	Json::Value member(Json::Value const& _node, std::string const& _name);
+	Json::Value const& member(Json::Value const& _node, std::string const& _name);
 	/// @returns the appropriate TokenObject used in parsed Strings (pragma directive or operator)
 	Token scanSingleToken(Json::Value const& _node);
 	template<class T>
 	///@returns nullptr or an ASTPointer cast to a specific Class
 	ASTPointer<T> nullOrCast(Json::Value const& _json);
 	/// @returns nullptr or ASTString, given an JSON string or an empty field
-	ASTPointer<ASTString> nullOrASTString(Json::Value const& _json, std::string const& _name);
+	ASTPointer<ASTString const> nullOrASTString(Json::Value const& _json, std::string const& _name);
 
 	// ============== JSON to definition helpers ===============
 	/// \defgroup typeHelpers Json to ast-datatype helpers
 	/// {@
-	ASTPointer<ASTString> memberAsASTString(Json::Value const& _node, std::string const& _name);
+	ASTPointer<ASTString const> memberAsASTString(Json::Value const& _node, std::string const& _name);
 	bool memberAsBool(Json::Value const& _node, std::string const& _name);
 	Visibility visibility(Json::Value const& _node);
 	StateMutability stateMutability(Json::Value const& _node);
@@ -148,8 +148,6 @@ private:
 	///@}
 
 	// =========== member variables ===============
-	/// Stores filepath as sourcenames to AST in JSON format
-	std::map<std::string, Json::Value> m_sourceList;
 	/// list of filepaths (used as sourcenames)
 	std::vector<std::shared_ptr<std::string const>> m_sourceLocations;
 	/// filepath to AST
@@ -62,11 +62,10 @@ T AsmJsonImporter::createAsmNode(Json::Value const& _node)
 	return r;
 }
 
-Json::Value AsmJsonImporter::member(Json::Value const& _node, string const& _name)
+Json::Value const& AsmJsonImporter::member(Json::Value const& _node, string const& _name)
 {
-	if (!_node.isMember(_name))
-		return Json::nullValue;
-	return _node[_name];
+	Json::Value const* value = _node.find(_name.data(), _name.data() + _name.size());
+	return value ? *value : Json::Value::nullSingleton();
 }
 
 yul::TypedName AsmJsonImporter::createTypedName(Json::Value const& _node)
@@ -37,7 +37,6 @@
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/join.hpp>
 #include <boost/algorithm/string/predicate.hpp>
-#include <boost/algorithm/string/replace.hpp>
 #include <boost/algorithm/string/split.hpp>
 #include <boost/range/adaptor/reversed.hpp>
 #include <boost/range/adaptor/sliced.hpp>
@@ -157,8 +156,10 @@ util::Result<TypePointers> transformParametersToExternal(TypePointers const& _pa
 void Type::clearCache() const
 {
 	m_members.clear();
+	m_nativeMembers.reset();
 	m_stackItems.reset();
 	m_stackSize.reset();
+	m_identifier.reset();
 }
 
 void StorageOffsets::computeOffsets(TypePointers const& _types)
@@ -206,16 +207,22 @@ pair<u256, unsigned> const* StorageOffsets::offset(size_t _index) const
 void MemberList::combine(MemberList const & _other)
 {
 	m_memberTypes += _other.m_memberTypes;
+	buildIndex();
 }
 
-pair<u256, unsigned> const* MemberList::memberStorageOffset(string const& _name) const
+void MemberList::buildIndex()
 {
-	StorageOffsets const& offsets = storageOffsets();
-
+	m_indicesByName.clear();
 	for (size_t index = 0; index < m_memberTypes.size(); ++index)
-		if (m_memberTypes[index].name == _name)
-			return offsets.offset(index);
-	return nullptr;
+		m_indicesByName[m_memberTypes[index].name].push_back(index);
+}
+
+pair<u256, unsigned> const* MemberList::memberStorageOffset(string const& _name) const
+{
+	auto it = m_indicesByName.find(_name);
+	if (it == m_indicesByName.end())
+		return nullptr;
+	return storageOffsets().offset(it->second.front());
 }
 
 u256 const& MemberList::storageSize() const
@@ -284,24 +291,34 @@ string parenthesizeUserIdentifier(string const& _internal)
 
 string Type::escapeIdentifier(string const& _identifier)
 {
-	string ret = _identifier;
-	// FIXME: should be _$$$_
-	boost::algorithm::replace_all(ret, "$", "$$$");
-	boost::algorithm::replace_all(ret, ",", "_$_");
-	boost::algorithm::replace_all(ret, "(", "$_");
-	boost::algorithm::replace_all(ret, ")", "_$");
+	string ret;
+	ret.reserve(_identifier.size());
+	for (char c: _identifier)
+		switch (c)
+		{
+		// FIXME: should be _$$$_
+		case '$': ret += "$$$"; break;
+		case ',': ret += "_$_"; break;
+		case '(': ret += "$_"; break;
+		case ')': ret += "_$"; break;
+		default: ret += c;
+		}
 	return ret;
 }
 
-string Type::identifier() const
+string const& Type::identifier() const
 {
-	string ret = escapeIdentifier(richIdentifier());
-	solAssert(ret.find_first_of("0123456789") != 0, "Identifier cannot start with a number.");
-	solAssert(
-		ret.find_first_not_of("0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMONPQRSTUVWXYZ_$") == string::npos,
-		"Identifier contains invalid characters."
-	);
-	return ret;
+	if (!m_identifier)
+	{
+		string ret = escapeIdentifier(richIdentifier());
+		solAssert(ret.find_first_of("0123456789") != 0, "Identifier cannot start with a number.");
+		solAssert(
+			ret.find_first_not_of("0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMONPQRSTUVWXYZ_$") == string::npos,
+			"Identifier contains invalid characters."
+		);
+		m_identifier = move(ret);
+	}
+	return *m_identifier;
 }
 
 TypePointer Type::commonType(Type const* _a, Type const* _b)
@@ -318,19 +335,32 @@ TypePointer Type::commonType(Type const* _a, Type const* _b)
 
 MemberList const& Type::members(ASTNode const* _currentScope) const
 {
-	if (!m_members[_currentScope])
+	shared_ptr<MemberList const>& members = m_members[_currentScope];
+	if (!members)
 	{
 		solAssert(
 			_currentScope == nullptr ||
 			dynamic_cast<SourceUnit const*>(_currentScope) ||
 			dynamic_cast<ContractDefinition const*>(_currentScope),
 		"");
-		MemberList::MemberMap members = nativeMembers(_currentScope);
+		MemberList::MemberMap boundMembers;
 		if (_currentScope)
-			members += boundFunctions(*this, *_currentScope);
-		m_members[_currentScope] = make_unique<MemberList>(move(members));
+			boundMembers = boundFunctions(*this, *_currentScope);
+		if (nativeMembersDependOnScope())
+			members = make_shared<MemberList>(nativeMembers(_currentScope) + boundMembers);
+		else
+		{
+			if (!m_nativeMembers)
+				m_nativeMembers = make_shared<MemberList>(nativeMembers(nullptr));
+			if (boundMembers.empty())
+				members = m_nativeMembers;
+			else
+				members = make_shared<MemberList>(
+					MemberList::MemberMap(m_nativeMembers->begin(), m_nativeMembers->end()) + boundMembers
+				);
+		}
 	}
-	return *m_members[_currentScope];
+	return *members;
 }
 
 TypePointer Type::fullEncodingType(bool _inLibraryCall, bool _encoderV2, bool) const
@@ -386,6 +416,9 @@ MemberList::MemberMap Type::boundFunctions(Type const& _type, ASTNode const& _sc
 		// directive applies.
 		// Further down, we check more detailed for each function if `_type` is
 		// convertible to the function parameter type.
+		// Directives for types of a different category can be skipped without creating the pointer types.
+		if (ufd->typeName() && ufd->typeName()->annotation().type->category() != _type.category())
+			continue;
 		if (ufd->typeName() &&
 			*TypeProvider::withLocationIfReference(typeLocation, &_type, true) !=
 			*TypeProvider::withLocationIfReference(
@@ -1759,6 +1792,8 @@ string ArrayType::richIdentifier() const
 
 bool ArrayType::operator==(Type const& _other) const
 {
+	if (this == &_other)
+		return true;
 	if (_other.category() != category())
 		return false;
 	ArrayType const& other = dynamic_cast<ArrayType const&>(_other);
@@ -2264,6 +2299,8 @@ string StructType::richIdentifier() const
 
 bool StructType::operator==(Type const& _other) const
 {
+	if (this == &_other)
+		return true;
 	if (_other.category() != category())
 		return false;
 	StructType const& other = dynamic_cast<StructType const&>(_other);
@@ -3079,6 +3116,8 @@ string FunctionType::richIdentifier() const
 
 bool FunctionType::operator==(Type const& _other) const
 {
+	if (this == &_other)
+		return true;
 	if (_other.category() != category())
 		return false;
 	FunctionType const& other = dynamic_cast<FunctionType const&>(_other);
@@ -3767,6 +3806,8 @@ string MappingType::richIdentifier() const
 
 bool MappingType::operator==(Type const& _other) const
 {
+	if (this == &_other)
+		return true;
 	if (_other.category() != category())
 		return false;
 	MappingType const& other = dynamic_cast<MappingType const&>(_other);
@@ -3813,6 +3854,8 @@ string TypeType::richIdentifier() const
 
 bool TypeType::operator==(Type const& _other) const
 {
+	if (this == &_other)
+		return true;
 	if (_other.category() != category())
 		return false;
 	TypeType const& other = dynamic_cast<TypeType const&>(_other);
@@ -40,6 +40,7 @@
 #include <optional>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 namespace solidity::frontend
@@ -114,26 +115,23 @@ public:
 
 	using MemberMap = std::vector<Member>;
 
-	explicit MemberList(MemberMap _members): m_memberTypes(std::move(_members)) {}
+	explicit MemberList(MemberMap _members): m_memberTypes(std::move(_members)) { buildIndex(); }
 
 	void combine(MemberList const& _other);
 	TypePointer memberType(std::string const& _name) const
 	{
-		TypePointer type = nullptr;
-		for (auto const& it: m_memberTypes)
-			if (it.name == _name)
-			{
-				solAssert(!type, "Requested member type by non-unique name.");
-				type = it.type;
-			}
-		return type;
+		auto it = m_indicesByName.find(_name);
+		if (it == m_indicesByName.end())
+			return nullptr;
+		solAssert(it->second.size() == 1, "Requested member type by non-unique name.");
+		return m_memberTypes[it->second.front()].type;
 	}
 	MemberMap membersByName(std::string const& _name) const
 	{
 		MemberMap members;
-		for (auto const& it: m_memberTypes)
-			if (it.name == _name)
-				members.push_back(it);
+		if (auto it = m_indicesByName.find(_name); it != m_indicesByName.end())
+			for (size_t index: it->second)
+				members.push_back(m_memberTypes[index]);
 		return members;
 	}
 	/// @returns the offset of the given member in storage slots and bytes inside a slot or
@@ -147,8 +145,11 @@ public:
 
 private:
 	StorageOffsets const& storageOffsets() const;
+	void buildIndex();
 
 	MemberMap m_memberTypes;
+	/// Positions of the members in m_memberTypes, by name.
+	std::unordered_map<std::string, std::vector<size_t>> m_indicesByName;
 	util::LazyInit<StorageOffsets> m_storageOffsets;
 };
 
@@ -188,7 +189,8 @@ public:
 	/// only if they have the same identifier.
 	/// The identifier should start with "t_".
 	/// Will not contain any character which would be invalid as an identifier.
-	std::string identifier() const;
+	/// The identifier is computed once per type instance and cached.
+	std::string const& identifier() const;
 
 	/// More complex identifier strings use "parentheses", where $_ is interpreted as
 	/// "opening parenthesis", _$ as "closing parenthesis", _$_ as "comma" and any $ that
@@ -213,7 +215,9 @@ public:
 		return TokenTraits::isCompareOp(_operator) ? commonType(this, _other) : nullptr;
 	}
 
-	virtual bool operator==(Type const& _other) const { return category() == _other.category(); }
+	/// Types are immutable, so identical instances are always equal. Overrides
+	/// for composite types check this first to avoid comparing their components.
+	virtual bool operator==(Type const& _other) const { return this == &_other || category() == _other.category(); }
 	virtual bool operator!=(Type const& _other) const { return !this->operator ==(_other); }
 
 	/// @returns number of bytes used by this type when encoded for CALL. Cannot be used for
@@ -384,6 +388,9 @@ protected:
 	{
 		return MemberList::MemberMap();
 	}
+	/// @returns true if nativeMembers depends on the scope. Otherwise, the native members
+	/// are only computed once and shared by the member lists of all scopes.
+	virtual bool nativeMembersDependOnScope() const { return false; }
 	/// Generates the stack items to be returned by ``stackItems()``. Defaults
 	/// to exactly one unnamed and untyped stack item referring to a single stack slot.
 	virtual std::vector<std::tuple<std::string, TypePointer>> makeStackItems() const
@@ -392,10 +399,14 @@ protected:
 	}
 
 
-	/// List of member types (parameterised by scape), will be lazy-initialized.
-	mutable std::map<ASTNode const*, std::unique_ptr<MemberList>> m_members;
+	/// List of member types (parameterised by scope), will be lazy-initialized.
+	/// Scopes without bound functions share m_nativeMembers.
+	mutable std::unordered_map<ASTNode const*, std::shared_ptr<MemberList const>> m_members;
+	/// Scope-independent native members, will be lazy-initialized.
+	mutable std::shared_ptr<MemberList const> m_nativeMembers;
 	mutable std::optional<std::vector<std::tuple<std::string, TypePointer>>> m_stackItems;
 	mutable std::optional<size_t> m_stackSize;
+	mutable std::optional<std::string> m_identifier;
 };
 
 /**
@@ -1270,6 +1281,7 @@ public:
 	bool nameable() const override;
 	bool hasSimpleZeroValueInMemory() const override { return false; }
 	MemberList::MemberMap nativeMembers(ASTNode const* _currentScope) const override;
+	bool nativeMembersDependOnScope() const override { return true; }
 	TypePointer encodingType() const override;
 	TypeResult interfaceType(bool _inLibrary) const override;
 	TypePointer mobileType() const override;
@@ -1444,6 +1456,7 @@ public:
 	bool hasSimpleZeroValueInMemory() const override { solAssert(false, ""); }
 	std::string toString(bool _short) const override { return "type(" + m_actualType->toString(_short) + ")"; }
 	MemberList::MemberMap nativeMembers(ASTNode const* _currentScope) const override;
+	bool nativeMembersDependOnScope() const override { return true; }
 
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 protected:
@@ -48,6 +48,9 @@ string ABIFunctions::tupleEncoder(
 	options.padded = true;
 	options.dynamicInplace = false;
 
+	MultiUseYulFunctionKey key("tupleEncoder", _givenTypes, _targetTypes, _encodeAsLibraryTypes, _reversed);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = string("abi_encode_tuple_");
 	for (auto const& t: _givenTypes)
 		functionName += t->identifier() + "_";
@@ -58,7 +61,7 @@ string ABIFunctions::tupleEncoder(
 	if (_reversed)
 		functionName += "_reversed";
 
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		// Note that the values are in reverse due to the difference in calling semantics.
 		Whiskers templ(R"(
 			function <functionName>(headStart <valueParams>) -> tail {
@@ -120,6 +123,9 @@ string ABIFunctions::tupleEncoderPacked(
 	options.padded = false;
 	options.dynamicInplace = true;
 
+	MultiUseYulFunctionKey key("tupleEncoderPacked", _givenTypes, _targetTypes, _reversed);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = string("abi_encode_tuple_packed_");
 	for (auto const& t: _givenTypes)
 		functionName += t->identifier() + "_";
@@ -130,7 +136,7 @@ string ABIFunctions::tupleEncoderPacked(
 	if (_reversed)
 		functionName += "_reversed";
 
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		solAssert(!_givenTypes.empty(), "");
 
 		// Note that the values are in reverse due to the difference in calling semantics.
@@ -179,13 +185,16 @@ string ABIFunctions::tupleEncoderPacked(
 }
 string ABIFunctions::tupleDecoder(TypePointers const& _types, bool _fromMemory)
 {
+	MultiUseYulFunctionKey key("tupleDecoder", _types, _fromMemory);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = string("abi_decode_tuple_");
 	for (auto const& t: _types)
 		functionName += t->identifier();
 	if (_fromMemory)
 		functionName += "_fromMemory";
 
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		TypePointers decodingTypes;
 		for (auto const& t: _types)
 			decodingTypes.emplace_back(t->decodingType());
@@ -341,13 +350,24 @@ string ABIFunctions::abiEncodingFunction(
 	solAssert(_from.sizeOnStack() == 1, "");
 	solAssert(to.isValueType(), "");
 	solAssert(to.calldataEncodedSize() == 32, "");
+	MultiUseYulFunctionKey key(
+		"abiEncodingFunction",
+		_from,
+		_to,
+		_options.padded,
+		_options.dynamicInplace,
+		_options.encodeFunctionFromStack,
+		_options.encodeAsLibraryTypes
+	);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"abi_encode_" +
 		_from.identifier() +
 		"_to_" +
 		to.identifier() +
 		_options.toFunctionNameSuffix();
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		solAssert(!to.isDynamicallyEncoded(), "");
 
 		Whiskers templ(R"(
@@ -387,13 +407,24 @@ string ABIFunctions::abiEncodeAndReturnUpdatedPosFunction(
 	ABIFunctions::EncodingOptions const& _options
 )
 {
+	MultiUseYulFunctionKey key(
+		"abiEncodeAndReturnUpdatedPosFunction",
+		_givenType,
+		_targetType,
+		_options.padded,
+		_options.dynamicInplace,
+		_options.encodeFunctionFromStack,
+		_options.encodeAsLibraryTypes
+	);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"abi_encodeUpdatedPos_" +
 		_givenType.identifier() +
 		"_to_" +
 		_targetType.identifier() +
 		_options.toFunctionNameSuffix();
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		string values = suffixedVariableNameList("value", 0, numVariablesForType(_givenType, _options));
 		string encoder = abiEncodingFunction(_givenType, _targetType, _options);
 		if (_targetType.isDynamicallyEncoded())
@@ -451,13 +482,24 @@ string ABIFunctions::abiEncodingFunctionCalldataArrayWithoutCleanup(
 		""
 	);
 
+	MultiUseYulFunctionKey key(
+		"abiEncodingFunctionCalldataArrayWithoutCleanup",
+		_from,
+		_to,
+		_options.padded,
+		_options.dynamicInplace,
+		_options.encodeFunctionFromStack,
+		_options.encodeAsLibraryTypes
+	);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"abi_encode_" +
 		_from.identifier() +
 		"_to_" +
 		_to.identifier() +
 		_options.toFunctionNameSuffix();
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		bool needsPadding = _options.padded && fromArrayType.isByteArray();
 		if (fromArrayType.isDynamicallySized())
 		{
@@ -517,6 +559,17 @@ string ABIFunctions::abiEncodingFunctionSimpleArray(
 	EncodingOptions const& _options
 )
 {
+	MultiUseYulFunctionKey key(
+		"abiEncodingFunctionSimpleArray",
+		_from,
+		_to,
+		_options.padded,
+		_options.dynamicInplace,
+		_options.encodeFunctionFromStack,
+		_options.encodeAsLibraryTypes
+	);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"abi_encode_" +
 		_from.identifier() +
@@ -530,7 +583,7 @@ string ABIFunctions::abiEncodingFunctionSimpleArray(
 	if (_from.dataStoredIn(DataLocation::Storage))
 		solAssert(_from.baseType()->storageBytes() > 16, "");
 
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		bool dynamic = _to.isDynamicallyEncoded();
 		bool dynamicBase = _to.baseType()->isDynamicallyEncoded();
 		bool const usesTail = dynamicBase && !_options.dynamicInplace;
@@ -627,6 +680,17 @@ string ABIFunctions::abiEncodingFunctionMemoryByteArray(
 	EncodingOptions const& _options
 )
 {
+	MultiUseYulFunctionKey key(
+		"abiEncodingFunctionMemoryByteArray",
+		_from,
+		_to,
+		_options.padded,
+		_options.dynamicInplace,
+		_options.encodeFunctionFromStack,
+		_options.encodeAsLibraryTypes
+	);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"abi_encode_" +
 		_from.identifier() +
@@ -639,7 +703,7 @@ string ABIFunctions::abiEncodingFunctionMemoryByteArray(
 	solAssert(_from.dataStoredIn(DataLocation::Memory), "");
 	solAssert(_from.isByteArray(), "");
 
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		solAssert(_to.isByteArray(), "");
 		Whiskers templ(R"(
 			function <functionName>(value, pos) -> end {
@@ -664,6 +728,17 @@ string ABIFunctions::abiEncodingFunctionCompactStorageArray(
 	EncodingOptions const& _options
 )
 {
+	MultiUseYulFunctionKey key(
+		"abiEncodingFunctionCompactStorageArray",
+		_from,
+		_to,
+		_options.padded,
+		_options.dynamicInplace,
+		_options.encodeFunctionFromStack,
+		_options.encodeAsLibraryTypes
+	);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"abi_encode_" +
 		_from.identifier() +
@@ -675,7 +750,7 @@ string ABIFunctions::abiEncodingFunctionCompactStorageArray(
 	solAssert(_from.length() == _to.length(), "");
 	solAssert(_from.dataStoredIn(DataLocation::Storage), "");
 
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		if (_from.isByteArray())
 		{
 			solAssert(_to.isByteArray(), "");
@@ -816,6 +891,17 @@ string ABIFunctions::abiEncodingFunctionStruct(
 	EncodingOptions const& _options
 )
 {
+	MultiUseYulFunctionKey key(
+		"abiEncodingFunctionStruct",
+		_from,
+		_to,
+		_options.padded,
+		_options.dynamicInplace,
+		_options.encodeFunctionFromStack,
+		_options.encodeAsLibraryTypes
+	);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"abi_encode_" +
 		_from.identifier() +
@@ -825,7 +911,7 @@ string ABIFunctions::abiEncodingFunctionStruct(
 
 	solAssert(&_from.structDefinition() == &_to.structDefinition(), "");
 
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		bool dynamic = _to.isDynamicallyEncoded();
 		Whiskers templ(R"(
 			// <readableTypeNameFrom> -> <readableTypeNameTo>
@@ -964,13 +1050,24 @@ string ABIFunctions::abiEncodingFunctionStringLiteral(
 {
 	solAssert(_from.category() == Type::Category::StringLiteral, "");
 
+	MultiUseYulFunctionKey key(
+		"abiEncodingFunctionStringLiteral",
+		_from,
+		_to,
+		_options.padded,
+		_options.dynamicInplace,
+		_options.encodeFunctionFromStack,
+		_options.encodeAsLibraryTypes
+	);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"abi_encode_" +
 		_from.identifier() +
 		"_to_" +
 		_to.identifier() +
 		_options.toFunctionNameSuffix();
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		auto const& strType = dynamic_cast<StringLiteralType const&>(_from);
 		string const& value = strType.value();
 		solAssert(_from.sizeOnStack() == 0, "");
@@ -1032,6 +1129,17 @@ string ABIFunctions::abiEncodingFunctionFunctionType(
 	solAssert(_from.kind() == FunctionType::Kind::External, "");
 	solAssert(_from == _to, "");
 
+	MultiUseYulFunctionKey key(
+		"abiEncodingFunctionFunctionType",
+		_from,
+		_to,
+		_options.padded,
+		_options.dynamicInplace,
+		_options.encodeFunctionFromStack,
+		_options.encodeAsLibraryTypes
+	);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"abi_encode_" +
 		_from.identifier() +
@@ -1040,7 +1148,7 @@ string ABIFunctions::abiEncodingFunctionFunctionType(
 		_options.toFunctionNameSuffix();
 
 	if (_options.encodeFunctionFromStack)
-		return createFunction(functionName, [&]() {
+		return createFunction(move(key), functionName, [&]() {
 			return Whiskers(R"(
 				function <functionName>(addr, function_id, pos) {
 					mstore(pos, <combineExtFun>(addr, function_id))
@@ -1051,7 +1159,7 @@ string ABIFunctions::abiEncodingFunctionFunctionType(
 			.render();
 		});
 	else
-		return createFunction(functionName, [&]() {
+		return createFunction(move(key), functionName, [&]() {
 			return Whiskers(R"(
 				function <functionName>(addr_and_function_id, pos) {
 					mstore(pos, <cleanExtFun>(addr_and_function_id))
@@ -1109,11 +1217,14 @@ string ABIFunctions::abiDecodingFunctionValueType(Type const& _type, bool _fromM
 	solAssert(!decodingType->isDynamicallyEncoded(), "");
 	solAssert(decodingType->calldataEncodedSize() == 32, "");
 
+	MultiUseYulFunctionKey key("abiDecodingFunctionValueType", _type, _fromMemory);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"abi_decode_" +
 		_type.identifier() +
 		(_fromMemory ? "_fromMemory" : "");
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(offset, end) -> value {
 				value := <load>(offset)
@@ -1135,6 +1246,9 @@ string ABIFunctions::abiDecodingFunctionArray(ArrayType const& _type, bool _from
 	solAssert(_type.dataStoredIn(DataLocation::Memory), "");
 	solAssert(!_type.isByteArray(), "");
 
+	MultiUseYulFunctionKey key("abiDecodingFunctionArray", _type, _fromMemory);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"abi_decode_" +
 		_type.identifier() +
@@ -1142,7 +1256,7 @@ string ABIFunctions::abiDecodingFunctionArray(ArrayType const& _type, bool _from
 
 	solAssert(!_type.dataStoredIn(DataLocation::Storage), "");
 
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		string load = _fromMemory ? "mload" : "calldataload";
 		bool dynamicBase = _type.baseType()->isDynamicallyEncoded();
 		Whiskers templ(
@@ -1207,10 +1321,13 @@ string ABIFunctions::abiDecodingFunctionCalldataArray(ArrayType const& _type)
 	solAssert(_type.calldataStride() > 0, "");
 	solAssert(_type.calldataStride() < u256("0xffffffffffffffff"), "");
 
+	MultiUseYulFunctionKey key("abiDecodingFunctionCalldataArray", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"abi_decode_" +
 		_type.identifier();
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		string templ;
 		if (_type.isDynamicallySized())
 			templ = R"(
@@ -1250,12 +1367,15 @@ string ABIFunctions::abiDecodingFunctionByteArray(ArrayType const& _type, bool _
 	solAssert(_type.dataStoredIn(DataLocation::Memory), "");
 	solAssert(_type.isByteArray(), "");
 
+	MultiUseYulFunctionKey key("abiDecodingFunctionByteArray", _type, _fromMemory);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"abi_decode_" +
 		_type.identifier() +
 		(_fromMemory ? "_fromMemory" : "");
 
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		Whiskers templ(
 			R"(
 				function <functionName>(offset, end) -> array {
@@ -1285,11 +1405,14 @@ string ABIFunctions::abiDecodingFunctionByteArray(ArrayType const& _type, bool _
 string ABIFunctions::abiDecodingFunctionCalldataStruct(StructType const& _type)
 {
 	solAssert(_type.dataStoredIn(DataLocation::CallData), "");
+	MultiUseYulFunctionKey key("abiDecodingFunctionCalldataStruct", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"abi_decode_" +
 		_type.identifier();
 
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		Whiskers w{R"(
 				// <readableTypeName>
 				function <functionName>(offset, end) -> value {
@@ -1309,12 +1432,15 @@ string ABIFunctions::abiDecodingFunctionCalldataStruct(StructType const& _type)
 string ABIFunctions::abiDecodingFunctionStruct(StructType const& _type, bool _fromMemory)
 {
 	solAssert(!_type.dataStoredIn(DataLocation::CallData), "");
+	MultiUseYulFunctionKey key("abiDecodingFunctionStruct", _type, _fromMemory);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"abi_decode_" +
 		_type.identifier() +
 		(_fromMemory ? "_fromMemory" : "");
 
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		Whiskers templ(R"(
 			// <readableTypeName>
 			function <functionName>(headStart, end) -> value {
@@ -1378,13 +1504,16 @@ string ABIFunctions::abiDecodingFunctionFunctionType(FunctionType const& _type,
 {
 	solAssert(_type.kind() == FunctionType::Kind::External, "");
 
+	MultiUseYulFunctionKey key("abiDecodingFunctionFunctionType", _type, _fromMemory, _forUseOnStack);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"abi_decode_" +
 		_type.identifier() +
 		(_fromMemory ? "_fromMemory" : "") +
 		(_forUseOnStack ? "_onStack" : "");
 
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		if (_forUseOnStack)
 		{
 			return Whiskers(R"(
@@ -1416,8 +1545,11 @@ string ABIFunctions::abiDecodingFunctionFunctionType(FunctionType const& _type,
 string ABIFunctions::calldataAccessFunction(Type const& _type)
 {
 	solAssert(_type.isValueType() || _type.dataStoredIn(DataLocation::CallData), "");
+	MultiUseYulFunctionKey key("calldataAccessFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "calldata_access_" + _type.identifier();
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		if (_type.isDynamicallyEncoded())
 		{
 			unsigned int tailSize = _type.calldataEncodedTailSize();
@@ -1495,8 +1627,18 @@ string ABIFunctions::calldataAccessFunction(Type const& _type)
 
 string ABIFunctions::arrayStoreLengthForEncodingFunction(ArrayType const& _type, EncodingOptions const& _options)
 {
+	MultiUseYulFunctionKey key(
+		"arrayStoreLengthForEncodingFunction",
+		_type,
+		_options.padded,
+		_options.dynamicInplace,
+		_options.encodeFunctionFromStack,
+		_options.encodeAsLibraryTypes
+	);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "array_storeLengthForEncoding_" + _type.identifier() + _options.toFunctionNameSuffix();
-	return createFunction(functionName, [&]() {
+	return createFunction(move(key), functionName, [&]() {
 		if (_type.isDynamicallySized() && !_options.dynamicInplace)
 			return Whiskers(R"(
 				function <functionName>(pos, length) -> updated_pos {
@@ -1522,6 +1664,15 @@ string ABIFunctions::createFunction(string const& _name, function<string ()> con
 	return m_functionCollector.createFunction(_name, _creator);
 }
 
+string ABIFunctions::createFunction(
+	MultiUseYulFunctionKey _key,
+	string const& _name,
+	function<string ()> const& _creator
+)
+{
+	return m_functionCollector.createFunction(move(_key), _name, _creator);
+}
+
 size_t ABIFunctions::headSize(TypePointers const& _targetTypes)
 {
 	size_t headSize = 0;
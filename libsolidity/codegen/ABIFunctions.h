@@ -257,6 +257,11 @@ private:
 	/// @a m_requestedFunctions if it has not been created yet and returns @a _name in both
 	/// cases.
 	std::string createFunction(std::string const& _name, std::function<std::string()> const& _creator);
+	std::string createFunction(
+		MultiUseYulFunctionKey _key,
+		std::string const& _name,
+		std::function<std::string()> const& _creator
+	);
 
 	/// @returns the size of the static part of the encoding of the given types.
 	static size_t headSize(TypePointers const& _targetTypes);
@@ -48,8 +48,10 @@
 
 #include <boost/algorithm/string/replace.hpp>
 
-#include <utility>
+#include <mutex>
 #include <numeric>
+#include <optional>
+#include <utility>
 
 // Change to "define" to output all intermediate code
 #undef SOL_OUTPUT_ASM
@@ -62,6 +64,61 @@ using namespace solidity::evmasm;
 using namespace solidity::frontend;
 using namespace solidity::langutil;
 
+namespace
+{
+
+/// Inline assembly snippet of the code generator after parsing and analysis.
+struct AnalysedSnippet
+{
+	shared_ptr<yul::Block> code;
+	shared_ptr<yul::AsmAnalysisInfo> analysisInfo;
+};
+
+/// Snippet text, local variables, source name and EVM version.
+using SnippetKey = tuple<string, vector<string>, string, langutil::EVMVersion>;
+
+/// Cache of analysed snippets, which is shared between all contracts since the same
+/// snippets are used over and over again. It is guarded by a mutex, since several
+/// compiler stacks may generate code at the same time.
+/// It is cleared together with the YulString repository the snippets refer to.
+class SnippetCache
+{
+public:
+	static SnippetCache& instance()
+	{
+		static SnippetCache cache;
+		static yul::YulStringRepository::ResetCallback callback{[&] { cache.clear(); }};
+		return cache;
+	}
+
+	optional<AnalysedSnippet> find(SnippetKey const& _key) const
+	{
+		lock_guard<mutex> lock(m_mutex);
+		auto it = m_snippets.find(_key);
+		if (it == m_snippets.end())
+			return nullopt;
+		return it->second;
+	}
+
+	void store(SnippetKey _key, AnalysedSnippet _snippet)
+	{
+		lock_guard<mutex> lock(m_mutex);
+		m_snippets.emplace(move(_key), move(_snippet));
+	}
+
+private:
+	void clear()
+	{
+		lock_guard<mutex> lock(m_mutex);
+		m_snippets.clear();
+	}
+
+	mutable mutex m_mutex;
+	map<SnippetKey, AnalysedSnippet> m_snippets;
+};
+
+}
+
 void CompilerContext::addStateVariable(
 	VariableDeclaration const& _declaration,
 	u256 const& _storageOffset,
@@ -384,6 +441,12 @@ void CompilerContext::appendInlineAssembly(
 {
 	unsigned startStackHeight = stackHeight();
 
+	// The snippet is parsed without source locations, the location of the call site
+	// is applied during code generation, so that the parsed snippet can be reused.
+	optional<langutil::SourceLocation> locationOverride;
+	if (!_system)
+		locationOverride = m_asm->currentSourceLocation();
+
 	set<yul::YulString> externallyUsedIdentifiers;
 	for (auto const& fun: _externallyUsedFunctions)
 		externallyUsedIdentifiers.insert(yul::YulString(fun));
@@ -416,7 +479,7 @@ void CompilerContext::appendInlineAssembly(
 		if (stackDiff < 1 || stackDiff > 16)
 			BOOST_THROW_EXCEPTION(
 				StackTooDeepError() <<
-				errinfo_sourceLocation(_identifier.location) <<
+				errinfo_sourceLocation(locationOverride ? *locationOverride : _identifier.location) <<
 				util::errinfo_comment("Stack too deep (" + to_string(stackDiff) + "), try removing local variables.")
 			);
 		if (_context == yul::IdentifierContext::RValue)
@@ -430,14 +493,29 @@ void CompilerContext::appendInlineAssembly(
 
 	ErrorList errors;
 	ErrorReporter errorReporter(errors);
-	auto scanner = make_shared<langutil::Scanner>(langutil::CharStream(_assembly, _sourceName));
 	yul::EVMDialect const& dialect = yul::EVMDialect::strictAssemblyForEVM(m_evmVersion);
-	optional<langutil::SourceLocation> locationOverride;
-	if (!_system)
-		locationOverride = m_asm->currentSourceLocation();
-	shared_ptr<yul::Block> parserResult =
-		yul::Parser(errorReporter, dialect, std::move(locationOverride))
-		.parse(scanner, false);
+	// Several optimizer steps cannot handle externally supplied stack variables,
+	// so we essentially only optimize the ABI functions.
+	bool const runYulOptimiser = _optimiserSettings.runYulOptimiser && _localVariables.empty();
+	// System-level assembly is only generated once per contract and not worth caching.
+	bool const useCache = !runYulOptimiser && !_system;
+	SnippetKey snippetKey{_assembly, _localVariables, _sourceName, m_evmVersion};
+	if (useCache)
+		if (optional<AnalysedSnippet> cached = SnippetCache::instance().find(snippetKey))
+		{
+			assembleInlineAssembly(
+				*cached->code,
+				*cached->analysisInfo,
+				identifierAccess,
+				_system,
+				_optimiserSettings,
+				move(locationOverride)
+			);
+			return;
+		}
+
+	auto scanner = make_shared<langutil::Scanner>(langutil::CharStream(_assembly, _sourceName));
+	shared_ptr<yul::Block> parserResult = yul::Parser(errorReporter, dialect).parse(scanner, false);
 #ifdef SOL_OUTPUT_ASM
 	cout << yul::AsmPrinter(&dialect)(*parserResult) << endl;
 #endif
@@ -457,11 +535,11 @@ void CompilerContext::appendInlineAssembly(
 		solAssert(false, message);
 	};
 
-	yul::AsmAnalysisInfo analysisInfo;
+	auto analysisInfo = make_shared<yul::AsmAnalysisInfo>();
 	bool analyzerResult = false;
 	if (parserResult)
 		analyzerResult = yul::AsmAnalyzer(
-			analysisInfo,
+			*analysisInfo,
 			errorReporter,
 			dialect,
 			identifierAccess.resolve
@@ -469,13 +547,11 @@ void CompilerContext::appendInlineAssembly(
 	if (!parserResult || !errorReporter.errors().empty() || !analyzerResult)
 		reportError("Invalid assembly generated by code generator.");
 
-	// Several optimizer steps cannot handle externally supplied stack variables,
-	// so we essentially only optimize the ABI functions.
-	if (_optimiserSettings.runYulOptimiser && _localVariables.empty())
+	if (runYulOptimiser)
 	{
 		yul::Object obj;
 		obj.code = parserResult;
-		obj.analysisInfo = make_shared<yul::AsmAnalysisInfo>(analysisInfo);
+		obj.analysisInfo = analysisInfo;
 
 		optimizeYul(obj, dialect, _optimiserSettings, externallyUsedIdentifiers);
 
@@ -490,7 +566,7 @@ void CompilerContext::appendInlineAssembly(
 			*obj.analysisInfo = yul::AsmAnalyzer::analyzeStrictAssertCorrect(dialect, obj);
 		}
 
-		analysisInfo = std::move(*obj.analysisInfo);
+		analysisInfo = std::move(obj.analysisInfo);
 		parserResult = std::move(obj.code);
 
 #ifdef SOL_OUTPUT_ASM
@@ -509,14 +585,36 @@ void CompilerContext::appendInlineAssembly(
 		reportError("Failed to analyze inline assembly block.");
 
 	solAssert(errorReporter.errors().empty(), "Failed to analyze inline assembly block.");
-	yul::CodeGenerator::assemble(
+	if (useCache)
+		SnippetCache::instance().store(move(snippetKey), {parserResult, analysisInfo});
+	assembleInlineAssembly(
 		*parserResult,
-		analysisInfo,
+		*analysisInfo,
+		identifierAccess,
+		_system,
+		_optimiserSettings,
+		move(locationOverride)
+	);
+}
+
+void CompilerContext::assembleInlineAssembly(
+	yul::Block const& _code,
+	yul::AsmAnalysisInfo& _analysisInfo,
+	yul::ExternalIdentifierAccess const& _identifierAccess,
+	bool _system,
+	OptimiserSettings const& _optimiserSettings,
+	optional<langutil::SourceLocation> _locationOverride
+)
+{
+	yul::CodeGenerator::assemble(
+		_code,
+		_analysisInfo,
 		*m_asm,
 		m_evmVersion,
-		identifierAccess,
+		_identifierAccess,
 		_system,
-		_optimiserSettings.optimizeStackAllocation
+		_optimiserSettings.optimizeStackAllocation,
+		move(_locationOverride)
 	);
 
 	// Reset the source location to the one of the node (instead of the CODEGEN source location)
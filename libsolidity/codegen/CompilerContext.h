@@ -38,9 +38,11 @@
 #include <libsolutil/Common.h>
 
 #include <libyul/AsmAnalysisInfo.h>
+#include <libyul/backends/evm/AbstractAssembly.h>
 #include <libyul/backends/evm/EVMDialect.h>
 
 #include <functional>
+#include <optional>
 #include <ostream>
 #include <stack>
 #include <queue>
@@ -60,13 +62,15 @@ public:
 	explicit CompilerContext(
 		langutil::EVMVersion _evmVersion,
 		RevertStrings _revertStrings,
-		CompilerContext* _runtimeContext = nullptr
+		CompilerContext* _runtimeContext = nullptr,
+		std::shared_ptr<MultiUseYulFunctionCache> _yulFunctionCache = nullptr
 	):
 		m_asm(std::make_shared<evmasm::Assembly>()),
 		m_evmVersion(_evmVersion),
 		m_revertStrings(_revertStrings),
 		m_reservedMemory{0},
 		m_runtimeContext(_runtimeContext),
+		m_yulFunctionCollector(std::move(_yulFunctionCache), _evmVersion, _revertStrings),
 		m_abiFunctions(m_evmVersion, m_revertStrings, m_yulFunctionCollector),
 		m_yulUtilFunctions(m_evmVersion, m_revertStrings, m_yulFunctionCollector)
 	{
@@ -323,6 +327,16 @@ private:
 	/// Updates source location set in the assembly.
 	void updateSourceLocation();
 
+	/// Generates the code for an analysed inline assembly snippet, see appendInlineAssembly.
+	void assembleInlineAssembly(
+		yul::Block const& _code,
+		yul::AsmAnalysisInfo& _analysisInfo,
+		yul::ExternalIdentifierAccess const& _identifierAccess,
+		bool _system,
+		OptimiserSettings const& _optimiserSettings,
+		std::optional<langutil::SourceLocation> _locationOverride
+	);
+
 	evmasm::Assembly::OptimiserSettings translateOptimiserSettings(OptimiserSettings const& _settings);
 
 	/**
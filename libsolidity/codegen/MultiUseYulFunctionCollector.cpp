@@ -24,11 +24,47 @@
 
 #include <liblangutil/Exceptions.h>
 
+#include <algorithm>
+#include <string_view>
+
 
 using namespace std;
 using namespace solidity;
 using namespace solidity::frontend;
 
+namespace
+{
+
+/// Calls @a _callback for every identifier in the Yul code @a _code.
+/// Identifiers inside of string literals are reported as well.
+template <class Callback>
+void forEachIdentifier(string const& _code, Callback const& _callback)
+{
+	auto isIdentifierStart = [](char _c) {
+		return ('a' <= _c && _c <= 'z') || ('A' <= _c && _c <= 'Z') || _c == '_' || _c == '$';
+	};
+	auto isIdentifierPart = [&](char _c) {
+		return isIdentifierStart(_c) || ('0' <= _c && _c <= '9') || _c == '.';
+	};
+
+	size_t pos = 0;
+	while (pos < _code.size())
+		if (isIdentifierPart(_code[pos]))
+		{
+			size_t end = pos + 1;
+			while (end < _code.size() && isIdentifierPart(_code[end]))
+				++end;
+			// Skip number literals.
+			if (isIdentifierStart(_code[pos]))
+				_callback(string_view(_code).substr(pos, end - pos));
+			pos = end;
+		}
+		else
+			++pos;
+}
+
+}
+
 string MultiUseYulFunctionCollector::requestedFunctions()
 {
 	string result;
@@ -39,18 +75,153 @@ string MultiUseYulFunctionCollector::requestedFunctions()
 		result += f.second;
 	}
 	m_requestedFunctions.clear();
+	m_memoisedNames.clear();
+	return result;
+}
+
+string MultiUseYulFunctionCollector::requestedFunctions(string const& _code)
+{
+	set<string const*> reachable;
+	vector<string const*> toVisit{&_code};
+	while (!toVisit.empty())
+	{
+		string const& code = *toVisit.back();
+		toVisit.pop_back();
+		forEachIdentifier(code, [&](string_view _identifier) {
+			auto it = m_requestedFunctions.find(_identifier);
+			if (it != m_requestedFunctions.end() && reachable.insert(&it->first).second)
+				toVisit.emplace_back(&it->second);
+		});
+	}
+
+	string result;
+	for (auto const& f: m_requestedFunctions)
+		if (reachable.count(&f.first))
+		{
+			solAssert(f.second != "<<STUB<<", "");
+			result += f.second;
+		}
+	m_requestedFunctions.clear();
+	m_memoisedNames.clear();
 	return result;
 }
 
 string MultiUseYulFunctionCollector::createFunction(string const& _name, function<string ()> const& _creator)
 {
-	if (!m_requestedFunctions.count(_name))
+	return collectFunction(_name, _creator, true);
+}
+
+string MultiUseYulFunctionCollector::createFunction(
+	MultiUseYulFunctionKey _key,
+	string const& _name,
+	function<string ()> const& _creator
+)
+{
+	string name = collectFunction(_name, _creator, true);
+	m_memoisedNames.emplace(move(_key), name);
+	return name;
+}
+
+string const* MultiUseYulFunctionCollector::memoisedName(MultiUseYulFunctionKey const& _key)
+{
+	auto it = m_memoisedNames.find(_key);
+	if (it == m_memoisedNames.end())
+		return nullptr;
+	if (!m_dependencies.empty())
+		m_dependencies.back().insert(it->second);
+	return &it->second;
+}
+
+string MultiUseYulFunctionCollector::createContractSpecificFunction(
+	string const& _name,
+	function<string ()> const& _creator
+)
+{
+	return collectFunction(_name, _creator, false);
+}
+
+string MultiUseYulFunctionCollector::collectFunction(
+	string const& _name,
+	function<string ()> const& _creator,
+	bool _shared
+)
+{
+	if (!m_dependencies.empty())
+		m_dependencies.back().insert(_name);
+	if (m_requestedFunctions.count(_name))
+		return _name;
+
+	_shared = _shared && m_cache;
+	if (_shared)
+		if (auto cached = m_cache->find(m_evmVersion, m_revertStrings, _name))
+		{
+			addCachedFunction(_name, *cached);
+			return _name;
+		}
+
+	m_requestedFunctions[_name] = "<<STUB<<";
+	m_dependencies.emplace_back();
+	string fun;
+	try
+	{
+		fun = _creator();
+	}
+	catch (...)
 	{
-		m_requestedFunctions[_name] = "<<STUB<<";
-		string fun = _creator();
-		solAssert(!fun.empty(), "");
-		solAssert(fun.find("function " + _name + "(") != string::npos, "Function not properly named.");
-		m_requestedFunctions[_name] = std::move(fun);
+		m_dependencies.pop_back();
+		throw;
 	}
+	set<string> dependencies = move(m_dependencies.back());
+	m_dependencies.pop_back();
+
+	solAssert(!fun.empty(), "");
+	solAssert(fun.find("function " + _name + "(") != string::npos, "Function not properly named.");
+	// Functions that use functions which are not cached (yet), as it happens for
+	// recursive functions, are not cached, since their dependencies could not be restored.
+	if (_shared && all_of(dependencies.begin(), dependencies.end(), [&](string const& _dependency) {
+		return _dependency == _name || m_cache->find(m_evmVersion, m_revertStrings, _dependency);
+	}))
+		m_cache->store(
+			m_evmVersion,
+			m_revertStrings,
+			_name,
+			{fun, vector<string>(dependencies.begin(), dependencies.end())}
+		);
+	m_requestedFunctions[_name] = std::move(fun);
 	return _name;
 }
+
+void MultiUseYulFunctionCollector::addCachedFunction(
+	string const& _name,
+	MultiUseYulFunctionCache::Function const& _function
+)
+{
+	m_requestedFunctions[_name] = _function.code;
+	for (string const& dependency: _function.dependencies)
+		if (!m_requestedFunctions.count(dependency))
+		{
+			auto cached = m_cache->find(m_evmVersion, m_revertStrings, dependency);
+			solAssert(cached, "Function used by cached function \"" + _name + "\" not cached.");
+			addCachedFunction(dependency, *cached);
+		}
+}
+
+shared_ptr<MultiUseYulFunctionCache::Function const> MultiUseYulFunctionCache::find(
+	langutil::EVMVersion _evmVersion,
+	RevertStrings _revertStrings,
+	string const& _name
+) const
+{
+	auto it = m_functions.find(make_tuple(_evmVersion, _revertStrings, _name));
+	return it == m_functions.end() ? nullptr : it->second;
+}
+
+void MultiUseYulFunctionCache::store(
+	langutil::EVMVersion _evmVersion,
+	RevertStrings _revertStrings,
+	string const& _name,
+	Function _function
+)
+{
+	m_functions[make_tuple(_evmVersion, _revertStrings, _name)] = make_shared<Function const>(move(_function));
+}
@@ -22,13 +22,124 @@
 
 #pragma once
 
+#include <libsolidity/ast/Types.h>
+#include <libsolidity/interface/DebugSettings.h>
+
+#include <liblangutil/EVMVersion.h>
+
+#include <cstdint>
 #include <functional>
 #include <map>
+#include <memory>
+#include <set>
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 namespace solidity::frontend
 {
 
+/**
+ * Cache of multi-use Yul functions shared between the code generators of all contracts
+ * of a compilation, so that helper functions like ABI coders, cleanup and conversion functions
+ * are only generated once per compilation instead of once per contract.
+ *
+ * Functions are identified by their name together with the settings they were generated for.
+ * Along with the code of each function, the names of the functions it uses are stored,
+ * so that they can be added to the code of a contract as well.
+ */
+class MultiUseYulFunctionCache
+{
+public:
+	struct Function
+	{
+		std::string code;
+		std::vector<std::string> dependencies;
+	};
+
+	/// @returns the cached function of name @a _name or nullptr if it is not cached.
+	std::shared_ptr<Function const> find(
+		langutil::EVMVersion _evmVersion,
+		RevertStrings _revertStrings,
+		std::string const& _name
+	) const;
+	void store(
+		langutil::EVMVersion _evmVersion,
+		RevertStrings _revertStrings,
+		std::string const& _name,
+		Function _function
+	);
+
+private:
+	std::map<
+		std::tuple<langutil::EVMVersion, RevertStrings, std::string>,
+		std::shared_ptr<Function const>
+	> m_functions;
+};
+
+/**
+ * Identifies a multi-use function by the generator that creates it and the arguments
+ * it is requested with, so that its name can be looked up without computing it.
+ *
+ * The generator is identified by the address of a string literal. Types are identified
+ * by their (cached) identifier, so that temporary types that are not owned by the
+ * TypeProvider cannot be mistaken for others.
+ */
+class MultiUseYulFunctionKey
+{
+public:
+	template <class... Arguments>
+	explicit MultiUseYulFunctionKey(char const* _generator, Arguments const&... _arguments)
+	{
+		m_values.reserve(1 + sizeof...(_arguments));
+		m_values.push_back(reinterpret_cast<std::uintptr_t>(_generator));
+		(append(_arguments), ...);
+	}
+
+	bool operator<(MultiUseYulFunctionKey const& _other) const
+	{
+		return std::tie(m_values, m_types) < std::tie(_other.m_values, _other.m_types);
+	}
+
+private:
+	template <class T>
+	void append(std::vector<T> const& _values)
+	{
+		m_values.push_back(_values.size());
+		for (T const& value: _values)
+			append(value);
+	}
+	template <class T>
+	void append(T const& _value)
+	{
+		if constexpr (std::is_pointer_v<T>)
+		{
+			static_assert(
+				std::is_base_of_v<Type, std::remove_cv_t<std::remove_pointer_t<T>>>,
+				"Only types can be passed by pointer."
+			);
+			m_values.push_back(_value ? 1 : 0);
+			if (_value)
+				append(*_value);
+		}
+		else if constexpr (std::is_base_of_v<Type, T>)
+		{
+			m_types += _value.identifier();
+			m_types += ',';
+		}
+		else
+		{
+			static_assert(std::is_integral_v<T> || std::is_enum_v<T>, "Unsupported key component.");
+			m_values.push_back(static_cast<std::uintptr_t>(_value));
+		}
+	}
+
+	std::vector<std::uintptr_t> m_values;
+	/// Identifiers of the types, each followed by a comma.
+	std::string m_types;
+};
+
 /**
  * Container of (unparsed) Yul functions identified by name which are meant to be generated
  * only once.
@@ -36,10 +147,41 @@ namespace solidity::frontend
 class MultiUseYulFunctionCollector
 {
 public:
+	MultiUseYulFunctionCollector() = default;
+	/// Creates a collector that takes functions from and adds functions to @a _cache,
+	/// assuming that they are generated for @a _evmVersion and @a _revertStrings.
+	MultiUseYulFunctionCollector(
+		std::shared_ptr<MultiUseYulFunctionCache> _cache,
+		langutil::EVMVersion _evmVersion,
+		RevertStrings _revertStrings
+	):
+		m_cache(std::move(_cache)),
+		m_evmVersion(_evmVersion),
+		m_revertStrings(_revertStrings)
+	{}
+
 	/// Helper function that uses @a _creator to create a function and add it to
 	/// @a m_requestedFunctions if it has not been created yet and returns @a _name in both
 	/// cases.
+	/// The code of the function must only depend on its name and the code generation settings,
+	/// since it is shared with other contracts via the cache.
 	std::string createFunction(std::string const& _name, std::function<std::string()> const& _creator);
+	/// Variant of createFunction that also remembers @a _name for @a _key.
+	std::string createFunction(
+		MultiUseYulFunctionKey _key,
+		std::string const& _name,
+		std::function<std::string()> const& _creator
+	);
+	/// @returns the name of the function created for @a _key via createFunction,
+	/// or nullptr if there is none, and records its use like createFunction does.
+	/// Allows generators to skip computing the name of a function requested repeatedly.
+	std::string const* memoisedName(MultiUseYulFunctionKey const& _key);
+	/// Variant of createFunction for functions whose code depends on the contract being
+	/// compiled. These are never taken from or added to the cache.
+	std::string createContractSpecificFunction(
+		std::string const& _name,
+		std::function<std::string()> const& _creator
+	);
 
 	/// @returns concatenation of all generated functions.
 	/// Guarantees that the order of functions in the generated code is deterministic and
@@ -47,13 +189,31 @@ public:
 	/// Clears the internal list, i.e. calling it again will result in an
 	/// empty return value.
 	std::string requestedFunctions();
+	/// @returns concatenation of the generated functions that are called from @a _code,
+	/// directly or via other functions, in the same order as above.
+	/// Functions that are not reachable in this way are dropped without ever being parsed.
+	/// Clears the internal list like the variant above.
+	std::string requestedFunctions(std::string const& _code);
 
 	/// @returns true IFF a function with the specified name has already been collected.
 	bool contains(std::string const& _name) const { return m_requestedFunctions.count(_name) > 0; }
 
 private:
+	std::string collectFunction(std::string const& _name, std::function<std::string()> const& _creator, bool _shared);
+	/// Adds the cached function @a _function of name @a _name and all its
+	/// dependencies that have not been collected yet.
+	void addCachedFunction(std::string const& _name, MultiUseYulFunctionCache::Function const& _function);
+
 	/// Map from function name to code for a multi-use function.
-	std::map<std::string, std::string> m_requestedFunctions;
+	std::map<std::string, std::string, std::less<>> m_requestedFunctions;
+	/// Names of the functions created for a key, cleared together with m_requestedFunctions.
+	std::map<MultiUseYulFunctionKey, std::string> m_memoisedNames;
+	/// For each function that is currently being created, the names of the functions it uses.
+	std::vector<std::set<std::string>> m_dependencies;
+
+	std::shared_ptr<MultiUseYulFunctionCache> m_cache;
+	langutil::EVMVersion m_evmVersion;
+	RevertStrings m_revertStrings = RevertStrings::Default;
 };
 
 }
@@ -71,8 +71,11 @@ string YulUtilFunctions::splitExternalFunctionIdFunction()
 
 string YulUtilFunctions::copyToMemoryFunction(bool _fromCalldata)
 {
+	MultiUseYulFunctionKey key("copyToMemoryFunction", _fromCalldata);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "copy_" + string(_fromCalldata ? "calldata" : "memory") + "_to_memory";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		if (_fromCalldata)
 		{
 			return Whiskers(R"(
@@ -109,13 +112,16 @@ string YulUtilFunctions::copyToMemoryFunction(bool _fromCalldata)
 
 string YulUtilFunctions::requireOrAssertFunction(bool _assert, Type const* _messageType)
 {
+	MultiUseYulFunctionKey key("requireOrAssertFunction", _assert, _messageType);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		string(_assert ? "assert_helper" : "require_helper") +
 		(_messageType ? ("_" + _messageType->identifier()) : "");
 
 	solAssert(!_assert || !_messageType, "Asserts can't have messages!");
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		if (!_messageType)
 			return Whiskers(R"(
 				function <functionName>(condition) {
@@ -160,8 +166,11 @@ string YulUtilFunctions::requireOrAssertFunction(bool _assert, Type const* _mess
 
 string YulUtilFunctions::leftAlignFunction(Type const& _type)
 {
+	MultiUseYulFunctionKey key("leftAlignFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = string("leftAlign_") + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(value) -> aligned {
 				<body>
@@ -171,7 +180,7 @@ string YulUtilFunctions::leftAlignFunction(Type const& _type)
 		switch (_type.category())
 		{
 		case Type::Category::Address:
-			templ("body", "aligned := " + leftAlignFunction(IntegerType(160)) + "(value)");
+			templ("body", "aligned := " + leftAlignFunction(*TypeProvider::uint(160)) + "(value)");
 			break;
 		case Type::Category::Integer:
 		{
@@ -186,7 +195,7 @@ string YulUtilFunctions::leftAlignFunction(Type const& _type)
 			solAssert(false, "Left align requested for rational number.");
 			break;
 		case Type::Category::Bool:
-			templ("body", "aligned := " + leftAlignFunction(IntegerType(8)) + "(value)");
+			templ("body", "aligned := " + leftAlignFunction(*TypeProvider::uint(8)) + "(value)");
 			break;
 		case Type::Category::FixedPoint:
 			solUnimplemented("Fixed point types not implemented.");
@@ -204,7 +213,7 @@ string YulUtilFunctions::leftAlignFunction(Type const& _type)
 		case Type::Category::Enum:
 		{
 			unsigned storageBytes = dynamic_cast<EnumType const&>(_type).storageBytes();
-			templ("body", "aligned := " + leftAlignFunction(IntegerType(8 * storageBytes)) + "(value)");
+			templ("body", "aligned := " + leftAlignFunction(*TypeProvider::uint(8 * storageBytes)) + "(value)");
 			break;
 		}
 		case Type::Category::InaccessibleDynamic:
@@ -222,8 +231,11 @@ string YulUtilFunctions::shiftLeftFunction(size_t _numBits)
 {
 	solAssert(_numBits < 256, "");
 
+	MultiUseYulFunctionKey key("shiftLeftFunction", _numBits);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "shift_left_" + to_string(_numBits);
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value) -> newValue {
@@ -271,8 +283,11 @@ string YulUtilFunctions::shiftRightFunction(size_t _numBits)
 	// Note that if this is extended with signed shifts,
 	// the opcodes SAR and SDIV behave differently with regards to rounding!
 
+	MultiUseYulFunctionKey key("shiftRightFunction", _numBits);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "shift_right_" + to_string(_numBits) + "_unsigned";
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value) -> newValue {
@@ -345,8 +360,11 @@ string YulUtilFunctions::typedShiftLeftFunction(Type const& _type, Type const& _
 	solAssert(_type.category() == Type::Category::FixedBytes || _type.category() == Type::Category::Integer, "");
 	solAssert(_amountType.category() == Type::Category::Integer, "");
 	solAssert(!dynamic_cast<IntegerType const&>(_amountType).isSigned(), "");
+	MultiUseYulFunctionKey key("typedShiftLeftFunction", _type, _amountType);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string const functionName = "shift_left_" + _type.identifier() + "_" + _amountType.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value, bits) -> result {
@@ -370,8 +388,11 @@ string YulUtilFunctions::typedShiftRightFunction(Type const& _type, Type const&
 	IntegerType const* integerType = dynamic_cast<IntegerType const*>(&_type);
 	bool valueSigned = integerType && integerType->isSigned();
 
+	MultiUseYulFunctionKey key("typedShiftRightFunction", _type, _amountType);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string const functionName = "shift_right_" + _type.identifier() + "_" + _amountType.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value, bits) -> result {
@@ -393,8 +414,11 @@ string YulUtilFunctions::updateByteSliceFunction(size_t _numBytes, size_t _shift
 	solAssert(_shiftBytes <= 32, "");
 	size_t numBits = _numBytes * 8;
 	size_t shiftBits = _shiftBytes * 8;
+	MultiUseYulFunctionKey key("updateByteSliceFunction", _numBytes, _shiftBytes);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "update_byte_slice_" + to_string(_numBytes) + "_shift_" + to_string(_shiftBytes);
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value, toInsert) -> result {
@@ -415,8 +439,11 @@ string YulUtilFunctions::updateByteSliceFunctionDynamic(size_t _numBytes)
 {
 	solAssert(_numBytes <= 32, "");
 	size_t numBits = _numBytes * 8;
+	MultiUseYulFunctionKey key("updateByteSliceFunctionDynamic", _numBytes);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "update_byte_slice_dynamic" + to_string(_numBytes);
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(value, shiftBytes, toInsert) -> result {
@@ -451,11 +478,14 @@ string YulUtilFunctions::roundUpFunction()
 
 string YulUtilFunctions::overflowCheckedIntAddFunction(IntegerType const& _type)
 {
+	MultiUseYulFunctionKey key("overflowCheckedIntAddFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "checked_add_" + _type.identifier();
 	// TODO: Consider to add a special case for unsigned 256-bit integers
 	//       and use the following instead:
 	//       sum := add(x, y) if lt(sum, x) { <panic>() }
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> sum {
@@ -485,8 +515,11 @@ string YulUtilFunctions::overflowCheckedIntAddFunction(IntegerType const& _type)
 
 string YulUtilFunctions::overflowCheckedIntMulFunction(IntegerType const& _type)
 {
+	MultiUseYulFunctionKey key("overflowCheckedIntMulFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "checked_mul_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return
 			// Multiplication by zero could be treated separately and directly return zero.
 			Whiskers(R"(
@@ -521,8 +554,11 @@ string YulUtilFunctions::overflowCheckedIntMulFunction(IntegerType const& _type)
 
 string YulUtilFunctions::overflowCheckedIntDivFunction(IntegerType const& _type)
 {
+	MultiUseYulFunctionKey key("overflowCheckedIntDivFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "checked_div_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> r {
@@ -550,8 +586,11 @@ string YulUtilFunctions::overflowCheckedIntDivFunction(IntegerType const& _type)
 
 string YulUtilFunctions::checkedIntModFunction(IntegerType const& _type)
 {
+	MultiUseYulFunctionKey key("checkedIntModFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "checked_mod_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> r {
@@ -571,8 +610,11 @@ string YulUtilFunctions::checkedIntModFunction(IntegerType const& _type)
 
 string YulUtilFunctions::overflowCheckedIntSubFunction(IntegerType const& _type)
 {
+	MultiUseYulFunctionKey key("overflowCheckedIntSubFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "checked_sub_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createFunction(move(key), functionName, [&] {
 		return
 			Whiskers(R"(
 			function <functionName>(x, y) -> diff {
@@ -606,8 +648,11 @@ string YulUtilFunctions::overflowCheckedIntExpFunction(
 {
 	solAssert(!_exponentType.isSigned(), "");
 
+	MultiUseYulFunctionKey key("overflowCheckedIntExpFunction", _type, _exponentType);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "checked_exp_" + _type.identifier() + "_" + _exponentType.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return
 			Whiskers(R"(
 			function <functionName>(base, exponent) -> power {
@@ -642,9 +687,12 @@ string YulUtilFunctions::overflowCheckedIntLiteralExpFunction(
 	solAssert(_baseType.isNegative() == _commonType.isSigned(), "");
 	solAssert(_commonType.numBits() == 256, "");
 
+	MultiUseYulFunctionKey key("overflowCheckedIntLiteralExpFunction", _baseType, _exponentType, _commonType);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "checked_exp_" + _baseType.richIdentifier() + "_" + _exponentType.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]()
+	return m_functionCollector.createFunction(move(key), functionName, [&]()
 	{
 		// Converts a bigint number into u256 (negative numbers represented in two's complement form.)
 		// We assume that `_v` fits in 256 bits.
@@ -915,8 +963,11 @@ string YulUtilFunctions::extractByteArrayLengthFunction()
 
 string YulUtilFunctions::arrayLengthFunction(ArrayType const& _type)
 {
+	MultiUseYulFunctionKey key("arrayLengthFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "array_length_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		Whiskers w(R"(
 			function <functionName>(value<?dynamic><?calldata>, len</calldata></dynamic>) -> length {
 				<?dynamic>
@@ -962,8 +1013,11 @@ std::string YulUtilFunctions::resizeDynamicArrayFunction(ArrayType const& _type)
 	solUnimplementedAssert(!_type.isByteArray(), "Byte Arrays not yet implemented!");
 	solUnimplementedAssert(_type.baseType()->storageBytes() <= 32, "...");
 
+	MultiUseYulFunctionKey key("resizeDynamicArrayFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "resize_array_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array, newLen) {
 				if gt(newLen, <maxArrayLength>) {
@@ -1014,8 +1068,11 @@ string YulUtilFunctions::storageArrayPopFunction(ArrayType const& _type)
 	if (_type.isByteArray())
 		return storageByteArrayPopFunction(_type);
 
+	MultiUseYulFunctionKey key("storageArrayPopFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "array_pop_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array) {
 				let oldLen := <fetchLength>(array)
@@ -1040,8 +1097,11 @@ string YulUtilFunctions::storageByteArrayPopFunction(ArrayType const& _type)
 	solAssert(_type.isDynamicallySized(), "");
 	solAssert(_type.isByteArray(), "");
 
+	MultiUseYulFunctionKey key("storageByteArrayPopFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "byte_array_pop_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array) {
 				let data := sload(array)
@@ -1091,8 +1151,11 @@ string YulUtilFunctions::storageArrayPushFunction(ArrayType const& _type)
 	solAssert(_type.isDynamicallySized(), "");
 	solUnimplementedAssert(_type.baseType()->storageBytes() <= 32, "Base type is not yet implemented.");
 
+	MultiUseYulFunctionKey key("storageArrayPushFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "array_push_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array, value) {
 				<?isByteArray>
@@ -1156,8 +1219,11 @@ string YulUtilFunctions::storageArrayPushZeroFunction(ArrayType const& _type)
 	solUnimplementedAssert(!_type.isByteArray(), "Byte Arrays not yet implemented!");
 	solUnimplementedAssert(_type.baseType()->storageBytes() <= 32, "Base type is not yet implemented.");
 
+	MultiUseYulFunctionKey key("storageArrayPushZeroFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "array_push_zero_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array) -> slot, offset {
 				let oldLen := <fetchLength>(array)
@@ -1196,9 +1262,12 @@ string YulUtilFunctions::clearStorageRangeFunction(Type const& _type)
 	if (_type.storageBytes() < 32)
 		solAssert(_type.isValueType(), "");
 
+	MultiUseYulFunctionKey key("clearStorageRangeFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "clear_storage_range_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(start, end) {
 				for {} lt(start, end) { start := add(start, <increment>) }
@@ -1227,9 +1296,12 @@ string YulUtilFunctions::clearStorageArrayFunction(ArrayType const& _type)
 	if (_type.baseType()->isValueType())
 		solAssert(_type.baseType()->storageSize() <= 1, "Invalid size for value type.");
 
+	MultiUseYulFunctionKey key("clearStorageArrayFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "clear_storage_array_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(slot) {
 				<?dynamic>
@@ -1260,9 +1332,12 @@ string YulUtilFunctions::clearStorageStructFunction(StructType const& _type)
 {
 	solAssert(_type.location() == DataLocation::Storage, "");
 
+	MultiUseYulFunctionKey key("clearStorageStructFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "clear_struct_storage_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createFunction(move(key), functionName, [&] {
 		MemberList::MemberMap structMembers = _type.nativeMembers(nullptr);
 		vector<map<string, string>> memberSetValues;
 
@@ -1316,8 +1391,11 @@ string YulUtilFunctions::copyArrayToStorage(ArrayType const& _fromType, ArrayTyp
 	solUnimplementedAssert(!_fromType.isByteArray(), "");
 	solUnimplementedAssert(!_fromType.dataStoredIn(DataLocation::Storage), "");
 
+	MultiUseYulFunctionKey key("copyArrayToStorage", _fromType, _toType);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "copy_array_to_storage_from_" + _fromType.identifier() + "_to_" + _toType.identifier();
-	return m_functionCollector.createFunction(functionName, [&](){
+	return m_functionCollector.createFunction(move(key), functionName, [&](){
 		Whiskers templ(R"(
 			function <functionName>(slot, value<?isFromDynamicCalldata>, len</isFromDynamicCalldata>) {
 				let length := <arrayLength>(value<?isFromDynamicCalldata>, len</isFromDynamicCalldata>)
@@ -1408,8 +1486,11 @@ string YulUtilFunctions::copyArrayToStorage(ArrayType const& _fromType, ArrayTyp
 
 string YulUtilFunctions::arrayConvertLengthToSize(ArrayType const& _type)
 {
+	MultiUseYulFunctionKey key("arrayConvertLengthToSize", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "array_convert_length_to_size_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		Type const& baseType = *_type.baseType();
 
 		switch (_type.location())
@@ -1462,8 +1543,11 @@ string YulUtilFunctions::arrayConvertLengthToSize(ArrayType const& _type)
 string YulUtilFunctions::arrayAllocationSizeFunction(ArrayType const& _type)
 {
 	solAssert(_type.dataStoredIn(DataLocation::Memory), "");
+	MultiUseYulFunctionKey key("arrayAllocationSizeFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "array_allocation_size_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		Whiskers w(R"(
 			function <functionName>(length) -> size {
 				// Make sure we can allocate memory without overflow
@@ -1490,8 +1574,11 @@ string YulUtilFunctions::arrayAllocationSizeFunction(ArrayType const& _type)
 
 string YulUtilFunctions::arrayDataAreaFunction(ArrayType const& _type)
 {
+	MultiUseYulFunctionKey key("arrayDataAreaFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "array_dataslot_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		// No special processing for calldata arrays, because they are stored as
 		// offset of the data area and length on the stack, so the offset already
 		// points to the data area.
@@ -1521,8 +1608,11 @@ string YulUtilFunctions::arrayDataAreaFunction(ArrayType const& _type)
 
 string YulUtilFunctions::storageArrayIndexAccessFunction(ArrayType const& _type)
 {
+	MultiUseYulFunctionKey key("storageArrayIndexAccessFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "storage_array_index_access_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(array, index) -> slot, offset {
 				let arrayLength := <arrayLen>(array)
@@ -1566,8 +1656,11 @@ string YulUtilFunctions::storageArrayIndexAccessFunction(ArrayType const& _type)
 
 string YulUtilFunctions::memoryArrayIndexAccessFunction(ArrayType const& _type)
 {
+	MultiUseYulFunctionKey key("memoryArrayIndexAccessFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "memory_array_index_access_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(baseRef, index) -> addr {
 				if iszero(lt(index, <arrayLen>(baseRef))) {
@@ -1593,8 +1686,11 @@ string YulUtilFunctions::memoryArrayIndexAccessFunction(ArrayType const& _type)
 string YulUtilFunctions::calldataArrayIndexAccessFunction(ArrayType const& _type)
 {
 	solAssert(_type.dataStoredIn(DataLocation::CallData), "");
+	MultiUseYulFunctionKey key("calldataArrayIndexAccessFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "calldata_array_index_access_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(base_ref<?dynamicallySized>, length</dynamicallySized>, index) -> addr<?dynamicallySizedBase>, len</dynamicallySizedBase> {
 				if iszero(lt(index, <?dynamicallySized>length<!dynamicallySized><arrayLen></dynamicallySized>)) { <panic>() }
@@ -1620,8 +1716,11 @@ string YulUtilFunctions::calldataArrayIndexRangeAccess(ArrayType const& _type)
 {
 	solAssert(_type.dataStoredIn(DataLocation::CallData), "");
 	solAssert(_type.isDynamicallySized(), "");
+	MultiUseYulFunctionKey key("calldataArrayIndexRangeAccess", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "calldata_array_index_range_access_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(offset, length, startIndex, endIndex) -> offsetOut, lengthOut {
 				if gt(startIndex, endIndex) { <revertSliceStartAfterEnd> }
@@ -1642,8 +1741,11 @@ string YulUtilFunctions::accessCalldataTailFunction(Type const& _type)
 {
 	solAssert(_type.isDynamicallyEncoded(), "");
 	solAssert(_type.dataStoredIn(DataLocation::CallData), "");
+	MultiUseYulFunctionKey key("accessCalldataTailFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "access_calldata_tail_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(base_ref, ptr_to_tail) -> addr<?dynamicallySized>, length</dynamicallySized> {
 				let rel_offset_of_tail := calldataload(ptr_to_tail)
@@ -1673,8 +1775,11 @@ string YulUtilFunctions::nextArrayElementFunction(ArrayType const& _type)
 	solAssert(!_type.isByteArray(), "");
 	if (_type.dataStoredIn(DataLocation::Storage))
 		solAssert(_type.baseType()->storageBytes() > 16, "");
+	MultiUseYulFunctionKey key("nextArrayElementFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "array_nextElement_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(ptr) -> next {
 				next := add(ptr, <advance>)
@@ -1713,9 +1818,12 @@ string YulUtilFunctions::copyArrayFromStorageToMemoryFunction(ArrayType const& _
 	if (!_from.isDynamicallySized())
 		solAssert(_from.length() == _to.length(), "");
 
+	MultiUseYulFunctionKey key("copyArrayFromStorageToMemoryFunction", _from, _to);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "copy_array_from_storage_to_memory_" + _from.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		if (_from.baseType()->isValueType())
 		{
 			solAssert(_from.baseType() == _to.baseType(), "");
@@ -1773,8 +1881,11 @@ string YulUtilFunctions::mappingIndexAccessFunction(MappingType const& _mappingT
 {
 	solAssert(_keyType.sizeOnStack() <= 1, "");
 
+	MultiUseYulFunctionKey key("mappingIndexAccessFunction", _mappingType, _keyType);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "mapping_index_access_" + _mappingType.identifier() + "_of_" + _keyType.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		if (_mappingType.keyType()->isDynamicallySized())
 			return Whiskers(R"(
 				function <functionName>(slot <?+key>,</+key> <key>) -> dataSlot {
@@ -1834,6 +1945,9 @@ string YulUtilFunctions::readFromStorageValueType(Type const& _type, size_t _off
 
 	if (_type.category() == Type::Category::Function)
 		solUnimplementedAssert(!_splitFunctionTypes, "");
+	MultiUseYulFunctionKey key("readFromStorageValueType", _type, _offset, _splitFunctionTypes);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 			"read_from_storage_" +
 			string(_splitFunctionTypes ? "split_" : "") +
@@ -1842,7 +1956,7 @@ string YulUtilFunctions::readFromStorageValueType(Type const& _type, size_t _off
 			"_" +
 			_type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createFunction(move(key), functionName, [&] {
 		solAssert(_type.sizeOnStack() == 1, "");
 		return Whiskers(R"(
 			function <functionName>(slot) -> value {
@@ -1860,12 +1974,15 @@ string YulUtilFunctions::readFromStorageValueTypeDynamic(Type const& _type, bool
 	if (_type.category() == Type::Category::Function)
 		solUnimplementedAssert(!_splitFunctionTypes, "");
 
+	MultiUseYulFunctionKey key("readFromStorageValueTypeDynamic", _type, _splitFunctionTypes);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"read_from_storage_value_type_dynamic" +
 		string(_splitFunctionTypes ? "split_" : "") +
 		"_" +
 		_type.identifier();
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createFunction(move(key), functionName, [&] {
 		solAssert(_type.sizeOnStack() == 1, "");
 		return Whiskers(R"(
 			function <functionName>(slot, offset) -> value {
@@ -1881,37 +1998,41 @@ string YulUtilFunctions::readFromStorageReferenceType(Type const& _type)
 {
 	solUnimplementedAssert(_type.category() == Type::Category::Struct, "");
 
+	MultiUseYulFunctionKey key("readFromStorageReferenceType", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "read_from_storage_reference_type_" + _type.identifier();
 
 	auto const& structType = dynamic_cast<StructType const&>(_type);
 	solAssert(structType.location() == DataLocation::Memory, "");
-	MemberList::MemberMap structMembers = structType.nativeMembers(nullptr);
-	vector<map<string, string>> memberSetValues(structMembers.size());
-	for (size_t i = 0; i < structMembers.size(); ++i)
-	{
-		auto const& [memberSlotDiff, memberStorageOffset] = structType.storageOffsetsOfMember(structMembers[i].name);
 
-		memberSetValues[i]["setMember"] = Whiskers(R"(
-			{
-				let <memberValues> := <readFromStorage>(add(slot, <memberSlotDiff>)<?hasOffset>, <memberStorageOffset></hasOffset>)
-				<writeToMemory>(add(value, <memberMemoryOffset>), <memberValues>)
-			}
-		)")
-		("memberValues", suffixedVariableNameList("memberValue_", 0, structMembers[i].type->stackItems().size()))
-		("memberMemoryOffset", structType.memoryOffsetOfMember(structMembers[i].name).str())
-		("memberSlotDiff",  memberSlotDiff.str())
-		("memberStorageOffset", to_string(memberStorageOffset))
-		("readFromStorage",
-			structMembers[i].type->isValueType() ?
-				readFromStorageDynamic(*structMembers[i].type, true) :
-				readFromStorage(*structMembers[i].type, memberStorageOffset, true)
-		)
-		("writeToMemory", writeToMemoryFunction(*structMembers[i].type))
-		("hasOffset", structMembers[i].type->isValueType())
-		.render();
-	}
+	return m_functionCollector.createFunction(move(key), functionName, [&] {
+		MemberList::MemberMap structMembers = structType.nativeMembers(nullptr);
+		vector<map<string, string>> memberSetValues(structMembers.size());
+		for (size_t i = 0; i < structMembers.size(); ++i)
+		{
+			auto const& [memberSlotDiff, memberStorageOffset] = structType.storageOffsetsOfMember(structMembers[i].name);
+
+			memberSetValues[i]["setMember"] = Whiskers(R"(
+				{
+					let <memberValues> := <readFromStorage>(add(slot, <memberSlotDiff>)<?hasOffset>, <memberStorageOffset></hasOffset>)
+					<writeToMemory>(add(value, <memberMemoryOffset>), <memberValues>)
+				}
+			)")
+			("memberValues", suffixedVariableNameList("memberValue_", 0, structMembers[i].type->stackItems().size()))
+			("memberMemoryOffset", structType.memoryOffsetOfMember(structMembers[i].name).str())
+			("memberSlotDiff",  memberSlotDiff.str())
+			("memberStorageOffset", to_string(memberStorageOffset))
+			("readFromStorage",
+				structMembers[i].type->isValueType() ?
+					readFromStorageDynamic(*structMembers[i].type, true) :
+					readFromStorage(*structMembers[i].type, memberStorageOffset, true)
+			)
+			("writeToMemory", writeToMemoryFunction(*structMembers[i].type))
+			("hasOffset", structMembers[i].type->isValueType())
+			.render();
+		}
 
-	return m_functionCollector.createFunction(functionName, [&] {
 		return Whiskers(R"(
 			function <functionName>(slot) -> value {
 				value := <allocStruct>()
@@ -1943,6 +2064,15 @@ string YulUtilFunctions::updateStorageValueFunction(
 	std::optional<unsigned> const& _offset
 )
 {
+	MultiUseYulFunctionKey key(
+		"updateStorageValueFunction",
+		_fromType,
+		_toType,
+		_offset.has_value(),
+		_offset.value_or(0)
+	);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string const functionName =
 		"update_storage_value_" +
 		(_offset.has_value() ? ("offset_" + to_string(*_offset)) : "") +
@@ -1950,7 +2080,7 @@ string YulUtilFunctions::updateStorageValueFunction(
 		"_to_" +
 		_toType.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createFunction(move(key), functionName, [&] {
 		if (_toType.isValueType())
 		{
 			solAssert(_fromType.isImplicitlyConvertibleTo(_toType), "");
@@ -2102,11 +2232,14 @@ string YulUtilFunctions::updateStorageValueFunction(
 
 string YulUtilFunctions::writeToMemoryFunction(Type const& _type)
 {
+	MultiUseYulFunctionKey key("writeToMemoryFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string const functionName =
 		string("write_to_memory_") +
 		_type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createFunction(move(key), functionName, [&] {
 		solAssert(!dynamic_cast<StringLiteralType const*>(&_type), "");
 		if (auto ref = dynamic_cast<ReferenceType const*>(&_type))
 		{
@@ -2163,11 +2296,14 @@ string YulUtilFunctions::extractFromStorageValueDynamic(Type const& _type, bool
 	if (_type.category() == Type::Category::Function)
 		solUnimplementedAssert(!_splitFunctionTypes, "");
 
+	MultiUseYulFunctionKey key("extractFromStorageValueDynamic", _type, _splitFunctionTypes);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"extract_from_storage_value_dynamic" +
 		string(_splitFunctionTypes ? "split_" : "") +
 		_type.identifier();
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createFunction(move(key), functionName, [&] {
 		return Whiskers(R"(
 			function <functionName>(slot_value, offset) -> value {
 				value := <cleanupStorage>(<shr>(mul(offset, 8), slot_value))
@@ -2184,13 +2320,16 @@ string YulUtilFunctions::extractFromStorageValue(Type const& _type, size_t _offs
 {
 	solUnimplementedAssert(!_splitFunctionTypes, "");
 
+	MultiUseYulFunctionKey key("extractFromStorageValue", _type, _offset, _splitFunctionTypes);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"extract_from_storage_value_" +
 		string(_splitFunctionTypes ? "split_" : "") +
 		"offset_" +
 		to_string(_offset) +
 		_type.identifier();
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createFunction(move(key), functionName, [&] {
 		return Whiskers(R"(
 			function <functionName>(slot_value) -> value {
 				value := <cleanupStorage>(<shr>(slot_value))
@@ -2209,8 +2348,11 @@ string YulUtilFunctions::cleanupFromStorageFunction(Type const& _type, bool _spl
 	if (_type.category() == Type::Category::Function)
 		solUnimplementedAssert(!_splitFunctionTypes, "");
 
+	MultiUseYulFunctionKey key("cleanupFromStorageFunction", _type, _splitFunctionTypes);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = string("cleanup_from_storage_") + (_splitFunctionTypes ? "split_" : "") + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createFunction(move(key), functionName, [&] {
 		Whiskers templ(R"(
 			function <functionName>(value) -> cleaned {
 				cleaned := <cleaned>
@@ -2241,8 +2383,11 @@ string YulUtilFunctions::prepareStoreFunction(Type const& _type)
 {
 	solUnimplementedAssert(_type.category() != Type::Category::Function, "");
 
+	MultiUseYulFunctionKey key("prepareStoreFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "prepare_store_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(value) -> ret {
 				ret := <actualPrepare>
@@ -2316,8 +2461,11 @@ string YulUtilFunctions::zeroMemoryFunction(Type const& _type)
 {
 	solAssert(_type.hasSimpleZeroValueInMemory(), "");
 
+	MultiUseYulFunctionKey key("zeroMemoryFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "zero_memory_chunk_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(dataStart, dataSizeInBytes) {
 				calldatacopy(dataStart, calldatasize(), dataSizeInBytes)
@@ -2332,8 +2480,11 @@ string YulUtilFunctions::zeroComplexMemoryArrayFunction(ArrayType const& _type)
 {
 	solAssert(!_type.baseType()->hasSimpleZeroValueInMemory(), "");
 
+	MultiUseYulFunctionKey key("zeroComplexMemoryArrayFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "zero_complex_memory_array_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		solAssert(_type.memoryStride() == 32, "");
 		return Whiskers(R"(
 			function <functionName>(dataStart, dataSizeInBytes) {
@@ -2351,8 +2502,11 @@ string YulUtilFunctions::zeroComplexMemoryArrayFunction(ArrayType const& _type)
 
 string YulUtilFunctions::allocateMemoryArrayFunction(ArrayType const& _type)
 {
+	MultiUseYulFunctionKey key("allocateMemoryArrayFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "allocate_memory_array_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return Whiskers(R"(
 				function <functionName>(length) -> memPtr {
 					let allocSize := <allocSize>(length)
@@ -2372,8 +2526,11 @@ string YulUtilFunctions::allocateMemoryArrayFunction(ArrayType const& _type)
 
 string YulUtilFunctions::allocateAndInitializeMemoryArrayFunction(ArrayType const& _type)
 {
+	MultiUseYulFunctionKey key("allocateAndInitializeMemoryArrayFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "allocate_and_zero_memory_array_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return Whiskers(R"(
 				function <functionName>(length) -> memPtr {
 					memPtr := <allocArray>(length)
@@ -2397,8 +2554,11 @@ string YulUtilFunctions::allocateAndInitializeMemoryArrayFunction(ArrayType cons
 
 string YulUtilFunctions::allocateMemoryStructFunction(StructType const& _type)
 {
+	MultiUseYulFunctionKey key("allocateMemoryStructFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "allocate_memory_struct_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		Whiskers templ(R"(
 		function <functionName>() -> memPtr {
 			memPtr := <alloc>(<allocSize>)
@@ -2414,8 +2574,11 @@ string YulUtilFunctions::allocateMemoryStructFunction(StructType const& _type)
 
 string YulUtilFunctions::allocateAndInitializeMemoryStructFunction(StructType const& _type)
 {
+	MultiUseYulFunctionKey key("allocateAndInitializeMemoryStructFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = "allocate_and_zero_memory_struct_" + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		Whiskers templ(R"(
 		function <functionName>() -> memPtr {
 			memPtr := <allocStruct>()
@@ -2447,6 +2610,10 @@ string YulUtilFunctions::allocateAndInitializeMemoryStructFunction(StructType co
 
 string YulUtilFunctions::conversionFunction(Type const& _from, Type const& _to)
 {
+	MultiUseYulFunctionKey key("conversionFunction", _from, _to);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
+
 	if (_from.category() == Type::Category::Function)
 	{
 		solAssert(_to.category() == Type::Category::Function, "");
@@ -2464,7 +2631,7 @@ string YulUtilFunctions::conversionFunction(Type const& _from, Type const& _to)
 			_from.identifier() +
 			"_to_" +
 			_to.identifier();
-		return m_functionCollector.createFunction(functionName, [&]() {
+		return m_functionCollector.createFunction(move(key), functionName, [&]() {
 			return Whiskers(R"(
 				function <functionName>(addr, functionId) -> outAddr, outFunctionId {
 					outAddr := addr
@@ -2496,7 +2663,7 @@ string YulUtilFunctions::conversionFunction(Type const& _from, Type const& _to)
 			_from.identifier() +
 			"_to_" +
 			_to.identifier();
-		return m_functionCollector.createFunction(functionName, [&]() {
+		return m_functionCollector.createFunction(move(key), functionName, [&]() {
 			return Whiskers(R"(
 				function <functionName>(offset, length) -> outOffset, outLength {
 					outOffset := offset
@@ -2516,7 +2683,7 @@ string YulUtilFunctions::conversionFunction(Type const& _from, Type const& _to)
 		_from.identifier() +
 		"_to_" +
 		_to.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(value) -> converted {
 				<body>
@@ -2531,7 +2698,7 @@ string YulUtilFunctions::conversionFunction(Type const& _from, Type const& _to)
 		case Type::Category::Address:
 			body =
 				Whiskers("converted := <convert>(value)")
-					("convert", conversionFunction(IntegerType(160), _to))
+					("convert", conversionFunction(*TypeProvider::uint(160), _to))
 					.render();
 			break;
 		case Type::Category::Integer:
@@ -2568,7 +2735,7 @@ string YulUtilFunctions::conversionFunction(Type const& _from, Type const& _to)
 			else if (toCategory == Type::Category::Address)
 				body =
 					Whiskers("converted := <convert>(value)")
-						("convert", conversionFunction(_from, IntegerType(160)))
+						("convert", conversionFunction(_from, *TypeProvider::uint(160)))
 						.render();
 			else
 			{
@@ -2693,12 +2860,12 @@ string YulUtilFunctions::conversionFunction(Type const& _from, Type const& _to)
 				body =
 					Whiskers("converted := <convert>(<shift>(value))")
 					("shift", shiftRightFunction(256 - from.numBytes() * 8))
-					("convert", conversionFunction(IntegerType(from.numBytes() * 8), _to))
+					("convert", conversionFunction(*TypeProvider::uint(from.numBytes() * 8), _to))
 					.render();
 			else if (toCategory == Type::Category::Address)
 				body =
 					Whiskers("converted := <convert>(value)")
-						("convert", conversionFunction(_from, IntegerType(160)))
+						("convert", conversionFunction(_from, *TypeProvider::uint(160)))
 						.render();
 			else
 			{
@@ -2743,8 +2910,11 @@ string YulUtilFunctions::conversionFunction(Type const& _from, Type const& _to)
 
 string YulUtilFunctions::cleanupFunction(Type const& _type)
 {
+	MultiUseYulFunctionKey key("cleanupFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = string("cleanup_") + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(value) -> cleaned {
 				<body>
@@ -2754,7 +2924,7 @@ string YulUtilFunctions::cleanupFunction(Type const& _type)
 		switch (_type.category())
 		{
 		case Type::Category::Address:
-			templ("body", "cleaned := " + cleanupFunction(IntegerType(160)) + "(value)");
+			templ("body", "cleaned := " + cleanupFunction(*TypeProvider::uint(160)) + "(value)");
 			break;
 		case Type::Category::Integer:
 		{
@@ -2780,7 +2950,7 @@ string YulUtilFunctions::cleanupFunction(Type const& _type)
 			switch (dynamic_cast<FunctionType const&>(_type).kind())
 			{
 				case FunctionType::Kind::External:
-					templ("body", "cleaned := " + cleanupFunction(FixedBytesType(24)) + "(value)");
+					templ("body", "cleaned := " + cleanupFunction(*TypeProvider::fixedBytes(24)) + "(value)");
 					break;
 				case FunctionType::Kind::Internal:
 					templ("body", "cleaned := value");
@@ -2814,10 +2984,9 @@ string YulUtilFunctions::cleanupFunction(Type const& _type)
 		}
 		case Type::Category::Contract:
 		{
-			AddressType addressType(dynamic_cast<ContractType const&>(_type).isPayable() ?
-				StateMutability::Payable :
-				StateMutability::NonPayable
-			);
+			Type const& addressType = dynamic_cast<ContractType const&>(_type).isPayable() ?
+				*TypeProvider::payableAddress() :
+				*TypeProvider::address();
 			templ("body", "cleaned := " + cleanupFunction(addressType) + "(value)");
 			break;
 		}
@@ -2840,8 +3009,11 @@ string YulUtilFunctions::cleanupFunction(Type const& _type)
 
 string YulUtilFunctions::validatorFunction(Type const& _type, bool _revertOnFailure)
 {
+	MultiUseYulFunctionKey key("validatorFunction", _type, _revertOnFailure);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = string("validator_") + (_revertOnFailure ? "revert_" : "assert_") + _type.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(value) {
 				if iszero(<condition>) { <failure> }
@@ -2893,6 +3065,9 @@ string YulUtilFunctions::packedHashFunction(
 	vector<Type const*> const& _targetTypes
 )
 {
+	MultiUseYulFunctionKey key("packedHashFunction", _givenTypes, _targetTypes);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName = string("packed_hashed_");
 	for (auto const& t: _givenTypes)
 		functionName += t->identifier() + "_";
@@ -2902,7 +3077,7 @@ string YulUtilFunctions::packedHashFunction(
 	size_t sizeOnStack = 0;
 	for (Type const* t: _givenTypes)
 		sizeOnStack += t->sizeOnStack();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		Whiskers templ(R"(
 			function <functionName>(<variables>) -> hash {
 				let pos := mload(<freeMemoryPointer>)
@@ -2948,9 +3123,12 @@ std::string YulUtilFunctions::decrementCheckedFunction(Type const& _type)
 {
 	IntegerType const& type = dynamic_cast<IntegerType const&>(_type);
 
+	MultiUseYulFunctionKey key("decrementCheckedFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string const functionName = "decrement_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		u256 minintval;
 
 		// Smallest admissible value to decrement
@@ -2979,9 +3157,12 @@ std::string YulUtilFunctions::incrementCheckedFunction(Type const& _type)
 {
 	IntegerType const& type = dynamic_cast<IntegerType const&>(_type);
 
+	MultiUseYulFunctionKey key("incrementCheckedFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string const functionName = "increment_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		u256 maxintval;
 
 		// Biggest admissible value to increment
@@ -3011,11 +3192,14 @@ string YulUtilFunctions::negateNumberCheckedFunction(Type const& _type)
 	IntegerType const& type = dynamic_cast<IntegerType const&>(_type);
 	solAssert(type.isSigned(), "Expected signed type!");
 
+	MultiUseYulFunctionKey key("negateNumberCheckedFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string const functionName = "negate_" + _type.identifier();
 
 	u256 const minintval = 0 - (u256(1) << (type.numBits() - 1)) + 1;
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		return Whiskers(R"(
 			function <functionName>(value) -> ret {
 				value := <cleanupFunction>(value)
@@ -3035,9 +3219,12 @@ string YulUtilFunctions::zeroValueFunction(Type const& _type, bool _splitFunctio
 {
 	solAssert(_type.category() != Type::Category::Mapping, "");
 
+	MultiUseYulFunctionKey key("zeroValueFunction", _type, _splitFunctionTypes);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string const functionName = "zero_value_for_" + string(_splitFunctionTypes ? "split_" : "") + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		FunctionType const* fType = dynamic_cast<FunctionType const*>(&_type);
 		if (fType && fType->kind() == FunctionType::Kind::External && _splitFunctionTypes)
 			return Whiskers(R"(
@@ -3108,9 +3295,12 @@ string YulUtilFunctions::zeroValueFunction(Type const& _type, bool _splitFunctio
 
 string YulUtilFunctions::storageSetToZeroFunction(Type const& _type)
 {
+	MultiUseYulFunctionKey key("storageSetToZeroFunction", _type);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string const functionName = "storage_set_to_zero_" + _type.identifier();
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		if (_type.isValueType())
 			return Whiskers(R"(
 				function <functionName>(slot, offset) {
@@ -3150,12 +3340,15 @@ string YulUtilFunctions::storageSetToZeroFunction(Type const& _type)
 
 string YulUtilFunctions::conversionFunctionSpecial(Type const& _from, Type const& _to)
 {
+	MultiUseYulFunctionKey key("conversionFunctionSpecial", _from, _to);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		"convert_" +
 		_from.identifier() +
 		"_to_" +
 		_to.identifier();
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createFunction(move(key), functionName, [&]() {
 		if (
 			auto fromTuple = dynamic_cast<TupleType const*>(&_from), toTuple = dynamic_cast<TupleType const*>(&_to);
 			fromTuple && toTuple && fromTuple->components().size() == toTuple->components().size()
@@ -3278,6 +3471,9 @@ string YulUtilFunctions::conversionFunctionSpecial(Type const& _from, Type const
 
 string YulUtilFunctions::readFromMemoryOrCalldata(Type const& _type, bool _fromCalldata)
 {
+	MultiUseYulFunctionKey key("readFromMemoryOrCalldata", _type, _fromCalldata);
+	if (string const* memoised = m_functionCollector.memoisedName(key))
+		return *memoised;
 	string functionName =
 		string("read_from_") +
 		(_fromCalldata ? "calldata" : "memory") +
@@ -3287,7 +3483,7 @@ string YulUtilFunctions::readFromMemoryOrCalldata(Type const& _type, bool _fromC
 	if (_fromCalldata)
 		solAssert(!_type.isDynamicallyEncoded(), "");
 
-	return m_functionCollector.createFunction(functionName, [&] {
+	return m_functionCollector.createFunction(move(key), functionName, [&] {
 		if (auto refType = dynamic_cast<ReferenceType const*>(&_type))
 		{
 			solAssert(refType->sizeOnStack() == 1, "");
@@ -3481,7 +3677,7 @@ string YulUtilFunctions::copyConstructorArgumentsToMemoryFunction(
 		"_" +
 		toString(_contract.id());
 
-	return m_functionCollector.createFunction(functionName, [&]() {
+	return m_functionCollector.createContractSpecificFunction(functionName, [&]() {
 		string returnParams = suffixedVariableNameList("ret_param_",0, _contract.constructor()->parameters().size());
 		ABIFunctions abiFunctions(m_evmVersion, m_revertStrings, m_functionCollector);
 
@@ -31,6 +31,8 @@
 #include <libsolidity/codegen/CompilerUtils.h>
 
 #include <libyul/AssemblyStack.h>
+#include <libyul/Object.h>
+#include <libyul/backends/evm/EVMDialect.h>
 #include <libyul/Utilities.h>
 
 #include <libsolutil/CommonData.h>
@@ -48,7 +50,24 @@ using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::frontend;
 
-pair<string, string> IRGenerator::run(
+namespace
+{
+
+string const& experimentalWarning()
+{
+	static string const warning =
+		"/*******************************************************\n"
+		" *                       WARNING                       *\n"
+		" *  Solidity to Yul compilation is still EXPERIMENTAL  *\n"
+		" *       It can result in LOSS OF FUNDS or worse       *\n"
+		" *                !USE AT YOUR OWN RISK!               *\n"
+		" *******************************************************/\n\n";
+	return warning;
+}
+
+}
+
+pair<string, shared_ptr<yul::Object>> IRGenerator::run(
 	ContractDefinition const& _contract,
 	map<ContractDefinition const*, string const> const& _otherYulSources
 )
@@ -65,15 +84,15 @@ pair<string, string> IRGenerator::run(
 	}
 	asmStack.optimize();
 
-	string warning =
-		"/*******************************************************\n"
-		" *                       WARNING                       *\n"
-		" *  Solidity to Yul compilation is still EXPERIMENTAL  *\n"
-		" *       It can result in LOSS OF FUNDS or worse       *\n"
-		" *                !USE AT YOUR OWN RISK!               *\n"
-		" *******************************************************/\n\n";
+	return {experimentalWarning() + ir, asmStack.parserResult()};
+}
 
-	return {warning + ir, warning + asmStack.print()};
+string IRGenerator::printOptimized(yul::Object const& _object, langutil::EVMVersion _evmVersion)
+{
+	return
+		experimentalWarning() +
+		_object.toString(&yul::EVMDialect::strictAssemblyForEVMObjects(_evmVersion)) +
+		"\n";
 }
 
 string IRGenerator::generate(
@@ -120,6 +139,10 @@ string IRGenerator::generate(
 	t("CreationObject", IRNames::creationObject(_contract));
 	t("notLibrary", !_contract.isLibrary());
 
+	// Code of the creation object outside of functions, from which the functions
+	// that are included in the object have to be reachable.
+	string creationCode;
+
 	FunctionDefinition const* constructor = _contract.constructor();
 	t("callValueCheck", !constructor || !constructor->isPayable() ? callValueCheck() : "");
 	vector<string> constructorParams;
@@ -127,20 +150,24 @@ string IRGenerator::generate(
 	{
 		for (size_t i = 0; i < constructor->parameters().size(); ++i)
 			constructorParams.emplace_back(m_context.newYulVariable());
-		t(
-			"copyConstructorArguments",
-			m_utils.copyConstructorArgumentsToMemoryFunction(_contract, IRNames::creationObject(_contract))
-		);
+		string copyConstructorArguments =
+			m_utils.copyConstructorArgumentsToMemoryFunction(_contract, IRNames::creationObject(_contract));
+		t("copyConstructorArguments", copyConstructorArguments);
+		creationCode += copyConstructorArguments + "\n";
 	}
 	t("constructorParams", joinHumanReadable(constructorParams));
 	t("constructorHasParams", !constructorParams.empty());
 	t("implicitConstructor", IRNames::implicitConstructor(_contract));
+	if (!_contract.isLibrary())
+		creationCode += IRNames::implicitConstructor(_contract) + "\n";
 
-	t("deploy", deployCode(_contract));
+	string deploy = deployCode(_contract);
+	t("deploy", deploy);
+	creationCode += deploy;
 	generateImplicitConstructors(_contract);
 	generateQueuedFunctions();
 	InternalDispatchMap internalDispatchMap = generateInternalDispatchFunctions();
-	t("functions", m_context.functionCollector().requestedFunctions());
+	t("functions", m_context.functionCollector().requestedFunctions(creationCode));
 	t("subObjects", subObjectSources(m_context.subObjectsCreated()));
 
 	// This has to be called only after all other code generation for the creation object is complete.
@@ -156,10 +183,11 @@ string IRGenerator::generate(
 
 	// Do not register immutables to avoid assignment.
 	t("RuntimeObject", IRNames::runtimeObject(_contract));
-	t("dispatch", dispatchRoutine(_contract));
+	string dispatch = dispatchRoutine(_contract);
+	t("dispatch", dispatch);
 	generateQueuedFunctions();
 	generateInternalDispatchFunctions();
-	t("runtimeFunctions", m_context.functionCollector().requestedFunctions());
+	t("runtimeFunctions", m_context.functionCollector().requestedFunctions(dispatch));
 	t("runtimeSubObjects", subObjectSources(m_context.subObjectsCreated()));
 
 	// This has to be called only after all other code generation for the runtime object is complete.
@@ -194,7 +222,7 @@ InternalDispatchMap IRGenerator::generateInternalDispatchFunctions()
 	for (YulArity const& arity: internalDispatchMap | boost::adaptors::map_keys)
 	{
 		string funName = IRNames::internalDispatch(arity);
-		m_context.functionCollector().createFunction(funName, [&]() {
+		m_context.functionCollector().createContractSpecificFunction(funName, [&]() {
 			Whiskers templ(R"(
 				function <functionName>(fun<?+in>, <in></+in>) <?+out>-> <out></+out> {
 					switch fun
@@ -248,7 +276,7 @@ InternalDispatchMap IRGenerator::generateInternalDispatchFunctions()
 string IRGenerator::generateFunction(FunctionDefinition const& _function)
 {
 	string functionName = IRNames::function(_function);
-	return m_context.functionCollector().createFunction(functionName, [&]() {
+	return m_context.functionCollector().createContractSpecificFunction(functionName, [&]() {
 		Whiskers t(R"(
 			function <functionName>(<params>)<?+retParams> -> <retParams></+retParams> {
 				<initReturnVariables>
@@ -277,7 +305,7 @@ string IRGenerator::generateFunction(FunctionDefinition const& _function)
 string IRGenerator::generateGetter(VariableDeclaration const& _varDecl)
 {
 	string functionName = IRNames::function(_varDecl);
-	return m_context.functionCollector().createFunction(functionName, [&]() {
+	return m_context.functionCollector().createContractSpecificFunction(functionName, [&]() {
 		Type const* type = _varDecl.annotation().type;
 
 		solAssert(_varDecl.isStateVariable(), "");
@@ -510,7 +538,7 @@ void IRGenerator::generateImplicitConstructors(ContractDefinition const& _contra
 		ContractDefinition const* contract = _contract.annotation().linearizedBaseContracts[i];
 		baseConstructorParams.erase(contract);
 
-		m_context.functionCollector().createFunction(IRNames::implicitConstructor(*contract), [&]() {
+		m_context.functionCollector().createContractSpecificFunction(IRNames::implicitConstructor(*contract), [&]() {
 			Whiskers t(R"(
 				function <functionName>(<params><comma><baseParams>) {
 					<evalBaseArguments>
@@ -698,7 +726,7 @@ void IRGenerator::resetContext(ContractDefinition const& _contract)
 		m_context.internalDispatchClean(),
 		"Reset internal dispatch map without consuming it."
 	);
-	m_context = IRGenerationContext(m_evmVersion, m_context.revertStrings(), m_optimiserSettings);
+	m_context = IRGenerationContext(m_evmVersion, m_context.revertStrings(), m_optimiserSettings, m_functionCache);
 
 	m_context.setMostDerivedContract(_contract);
 	for (auto const& var: ContractType(_contract).stateVariables())
@@ -28,8 +28,14 @@
 #include <libsolidity/codegen/ir/IRGenerationContext.h>
 #include <libsolidity/codegen/YulUtilFunctions.h>
 #include <liblangutil/EVMVersion.h>
+#include <memory>
 #include <string>
 
+namespace solidity::yul
+{
+struct Object;
+}
+
 namespace solidity::frontend
 {
 
@@ -41,21 +47,27 @@ public:
 	IRGenerator(
 		langutil::EVMVersion _evmVersion,
 		RevertStrings _revertStrings,
-		OptimiserSettings _optimiserSettings
+		OptimiserSettings _optimiserSettings,
+		std::shared_ptr<MultiUseYulFunctionCache> _functionCache = nullptr
 	):
 		m_evmVersion(_evmVersion),
 		m_optimiserSettings(_optimiserSettings),
-		m_context(_evmVersion, _revertStrings, std::move(_optimiserSettings)),
+		m_functionCache(_functionCache),
+		m_context(_evmVersion, _revertStrings, std::move(_optimiserSettings), std::move(_functionCache)),
 		m_utils(_evmVersion, m_context.revertStrings(), m_context.functionCollector())
 	{}
 
-	/// Generates and returns the IR code, in unoptimized and optimized form
-	/// (or just pretty-printed, depending on the optimizer settings).
-	std::pair<std::string, std::string> run(
+	/// Generates and returns the IR code in unoptimized form together with the
+	/// optimized (or just analyzed, depending on the optimizer settings) Yul object.
+	/// The latter is only turned into text by printOptimized if it is requested.
+	std::pair<std::string, std::shared_ptr<yul::Object>> run(
 		ContractDefinition const& _contract,
 		std::map<ContractDefinition const*, std::string const> const& _otherYulSources
 	);
 
+	/// @returns the textual form of an object returned by run.
+	static std::string printOptimized(yul::Object const& _object, langutil::EVMVersion _evmVersion);
+
 private:
 	std::string generate(
 		ContractDefinition const& _contract,
@@ -108,6 +120,7 @@ private:
 
 	langutil::EVMVersion const m_evmVersion;
 	OptimiserSettings const m_optimiserSettings;
+	std::shared_ptr<MultiUseYulFunctionCache> const m_functionCache;
 
 	IRGenerationContext m_context;
 	YulUtilFunctions m_utils;
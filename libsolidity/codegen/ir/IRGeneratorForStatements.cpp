@@ -249,7 +249,7 @@ string IRGeneratorForStatements::constantValueFunction(VariableDeclaration const
 		setLocation(_constant);
 
 		string functionName = IRNames::constantValueFunction(_constant);
-		return m_context.functionCollector().createFunction(functionName, [&] {
+		return m_context.functionCollector().createContractSpecificFunction(functionName, [&] {
 			Whiskers templ(R"(
 				function <functionName>() -> <ret> {
 					<code>
@@ -781,7 +781,7 @@ void IRGeneratorForStatements::endVisit(FunctionCall const& _functionCall)
 
 	TypePointers parameterTypes = functionType->parameterTypes();
 	vector<ASTPointer<Expression const>> const& callArguments = _functionCall.arguments();
-	vector<ASTPointer<ASTString>> const& callArgumentNames = _functionCall.names();
+	vector<ASTPointer<ASTString const>> const& callArgumentNames = _functionCall.names();
 	if (!functionType->takesArbitraryParameters())
 		solAssert(callArguments.size() == parameterTypes.size(), "");
 
@@ -793,7 +793,7 @@ void IRGeneratorForStatements::endVisit(FunctionCall const& _functionCall)
 		// named arguments
 		for (auto const& parameterName: functionType->parameterNames())
 		{
-			auto const it = std::find_if(callArgumentNames.cbegin(), callArgumentNames.cend(), [&](ASTPointer<ASTString> const& _argName) {
+			auto const it = std::find_if(callArgumentNames.cbegin(), callArgumentNames.cend(), [&](ASTPointer<ASTString const> const& _argName) {
 				return *_argName == parameterName;
 			});
 
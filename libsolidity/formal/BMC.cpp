@@ -23,6 +23,10 @@
 
 #include <libsmtutil/SMTPortfolio.h>
 
+#include <libsolutil/CommonData.h>
+
+#include <cctype>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::util;
@@ -34,10 +38,18 @@ BMC::BMC(
 	ErrorReporter& _errorReporter,
 	map<h256, string> const& _smtlib2Responses,
 	ReadCallback::Callback const& _smtCallback,
-	smtutil::SMTSolverChoice _enabledSolvers
+	smtutil::SMTSolverChoice _enabledSolvers,
+	smtutil::SMTPortfolioMode _portfolioMode,
+	smtutil::SMTQueryCache* _queryCache
 ):
 	SMTEncoder(_context),
-	m_interface(make_unique<smtutil::SMTPortfolio>(_smtlib2Responses, _smtCallback, _enabledSolvers)),
+	m_interface(make_unique<smtutil::SMTPortfolio>(
+		_smtlib2Responses,
+		_smtCallback,
+		_enabledSolvers,
+		_portfolioMode,
+		_queryCache
+	)),
 	m_outerErrorReporter(_errorReporter)
 {
 #if defined (HAVE_Z3) || defined (HAVE_CVC4)
@@ -58,6 +70,7 @@ void BMC::analyze(SourceUnit const& _source, map<ASTNode const*, set<Verificatio
 	solAssert(_source.annotation().experimentalFeatures.count(ExperimentalFeature::SMTChecker), "");
 
 	m_solvedTargets = move(_solvedTargets);
+	m_functionEncodings.clear();
 	m_context.setSolver(m_interface.get());
 	m_context.clear();
 	m_context.setAssertionAccumulation(true);
@@ -119,6 +132,8 @@ bool BMC::shouldInlineFunctionCall(FunctionCall const& _funCall)
 
 bool BMC::visit(ContractDefinition const& _contract)
 {
+	// The encodings refer to the symbolic variables of the previous contract.
+	m_functionEncodings.clear();
 	initContract(_contract);
 
 	SMTEncoder::visit(_contract);
@@ -463,6 +478,7 @@ void BMC::inlineFunctionCall(FunctionCall const& _funCall)
 	FunctionDefinition const* funDef = functionCallToDefinition(_funCall);
 	solAssert(funDef, "");
 
+	recordCallStackQuery(*funDef);
 	if (visitedFunction(funDef))
 	{
 		auto const& returnParams = funDef->returnParameters();
@@ -476,10 +492,16 @@ void BMC::inlineFunctionCall(FunctionCall const& _funCall)
 	{
 		initializeFunctionCallParameters(*funDef, symbolicArguments(_funCall));
 
-		// The reason why we need to pushCallStack here instead of visit(FunctionDefinition)
-		// is that there we don't have `_funCall`.
-		pushCallStack({funDef, &_funCall});
-		funDef->accept(*this);
+		if (!replayFunctionEncoding(*funDef, _funCall))
+		{
+			bool recording = startFunctionRecording();
+			// The reason why we need to pushCallStack here instead of visit(FunctionDefinition)
+			// is that there we don't have `_funCall`.
+			pushCallStack({funDef, &_funCall});
+			funDef->accept(*this);
+			if (recording)
+				stopFunctionRecording(*funDef);
+		}
 	}
 
 	createReturnedExpressions(_funCall);
@@ -579,15 +601,17 @@ void BMC::reset()
 	m_loopExecutionHappened = false;
 }
 
-pair<vector<smtutil::Expression>, vector<string>> BMC::modelExpressions()
+pair<vector<smtutil::Expression>, vector<string>> BMC::modelExpressions(vector<ModelKey>* _keys)
 {
 	vector<smtutil::Expression> expressionsToEvaluate;
 	vector<string> expressionNames;
+	vector<ModelKey> keys;
 	for (auto const& var: m_context.variables())
 		if (var.first->type()->isValueType())
 		{
 			expressionsToEvaluate.emplace_back(currentValue(*var.first));
 			expressionNames.push_back(var.first->name());
+			keys.emplace_back(var.first);
 		}
 	for (auto const& var: m_context.globalSymbols())
 	{
@@ -599,15 +623,23 @@ pair<vector<smtutil::Expression>, vector<string>> BMC::modelExpressions()
 		{
 			expressionsToEvaluate.emplace_back(var.second->currentValue());
 			expressionNames.push_back(var.first);
+			keys.emplace_back(var.first);
 		}
 	}
-	for (auto const& uf: m_uninterpretedTerms)
+	// The terms of the callers of recorded functions are set aside during the recording.
+	set<Expression const*> uninterpretedTerms = m_uninterpretedTerms;
+	for (auto const& recording: m_functionRecordings)
+		uninterpretedTerms += recording.callerUninterpretedTerms;
+	for (auto const& uf: uninterpretedTerms)
 		if (uf->annotation().type->isValueType())
 		{
 			expressionsToEvaluate.emplace_back(expr(*uf));
 			expressionNames.push_back(uf->location().text());
+			keys.emplace_back(uf);
 		}
 
+	if (_keys)
+		*_keys = move(keys);
 	return {expressionsToEvaluate, expressionNames};
 }
 
@@ -615,11 +647,31 @@ pair<vector<smtutil::Expression>, vector<string>> BMC::modelExpressions()
 
 void BMC::checkVerificationTargets(smtutil::Expression const& _constraints)
 {
+	bool constraintsAdded = false;
 	for (auto& target: m_verificationTargets)
-		checkVerificationTarget(target, _constraints);
+	{
+		bool arithmetic =
+			target.type == VerificationTarget::Type::Underflow ||
+			target.type == VerificationTarget::Type::Overflow ||
+			target.type == VerificationTarget::Type::UnderOverflow;
+		if (arithmetic && !constraintsAdded)
+		{
+			m_interface->push();
+			m_interface->addAssertion(_constraints);
+			constraintsAdded = true;
+		}
+		else if (!arithmetic && constraintsAdded)
+		{
+			m_interface->pop();
+			constraintsAdded = false;
+		}
+		checkVerificationTarget(target);
+	}
+	if (constraintsAdded)
+		m_interface->pop();
 }
 
-void BMC::checkVerificationTarget(BMCVerificationTarget& _target, smtutil::Expression const& _constraints)
+void BMC::checkVerificationTarget(BMCVerificationTarget& _target)
 {
 	switch (_target.type)
 	{
@@ -627,14 +679,14 @@ void BMC::checkVerificationTarget(BMCVerificationTarget& _target, smtutil::Expre
 			checkConstantCondition(_target);
 			break;
 		case VerificationTarget::Type::Underflow:
-			checkUnderflow(_target, _constraints);
+			checkUnderflow(_target);
 			break;
 		case VerificationTarget::Type::Overflow:
-			checkOverflow(_target, _constraints);
+			checkOverflow(_target);
 			break;
 		case VerificationTarget::Type::UnderOverflow:
-			checkUnderflow(_target, _constraints);
-			checkOverflow(_target, _constraints);
+			checkUnderflow(_target);
+			checkOverflow(_target);
 			break;
 		case VerificationTarget::Type::DivByZero:
 			checkDivByZero(_target);
@@ -660,7 +712,7 @@ void BMC::checkConstantCondition(BMCVerificationTarget& _target)
 	);
 }
 
-void BMC::checkUnderflow(BMCVerificationTarget& _target, smtutil::Expression const& _constraints)
+void BMC::checkUnderflow(BMCVerificationTarget& _target)
 {
 	solAssert(
 		_target.type == VerificationTarget::Type::Underflow ||
@@ -681,7 +733,7 @@ void BMC::checkUnderflow(BMCVerificationTarget& _target, smtutil::Expression con
 		intType = TypeProvider::uint256();
 
 	checkCondition(
-		_target.constraints && _constraints && _target.value < smt::minValue(*intType),
+		_target.constraints && _target.value < smt::minValue(*intType),
 		_target.callStack,
 		_target.modelExpressions,
 		_target.expression->location(),
@@ -693,7 +745,7 @@ void BMC::checkUnderflow(BMCVerificationTarget& _target, smtutil::Expression con
 	);
 }
 
-void BMC::checkOverflow(BMCVerificationTarget& _target, smtutil::Expression const& _constraints)
+void BMC::checkOverflow(BMCVerificationTarget& _target)
 {
 	solAssert(
 		_target.type == VerificationTarget::Type::Overflow ||
@@ -714,7 +766,7 @@ void BMC::checkOverflow(BMCVerificationTarget& _target, smtutil::Expression cons
 		intType = TypeProvider::uint256();
 
 	checkCondition(
-		_target.constraints && _constraints && _target.value > smt::maxValue(*intType),
+		_target.constraints && _target.value > smt::maxValue(*intType),
 		_target.callStack,
 		_target.modelExpressions,
 		_target.expression->location(),
@@ -784,22 +836,398 @@ void BMC::addVerificationTarget(
 	Expression const* _expression
 )
 {
+	smtutil::Expression pathConditions = currentPathConditions();
+	smtutil::Expression assertions = m_context.assertions();
+	vector<ModelKey> modelKeys;
 	BMCVerificationTarget target{
 		{
 			_type,
 			_value,
-			currentPathConditions() && m_context.assertions()
+			pathConditions && assertions
 		},
 		_expression,
 		m_callStack,
-		modelExpressions()
+		modelExpressions(&modelKeys)
 	};
+	recordVerificationTarget(target, pathConditions, assertions, modelKeys);
 	if (_type == VerificationTarget::Type::ConstantCondition)
 		checkVerificationTarget(target);
 	else
 		m_verificationTargets.emplace_back(move(target));
 }
 
+/// Function encodings.
+
+namespace
+{
+
+/// Splits the name of an SSA variable into the unique name of the variable and the index.
+optional<pair<string, unsigned>> splitSSAName(string const& _name)
+{
+	auto separator = _name.rfind('_');
+	if (
+		separator == string::npos ||
+		separator + 1 == _name.size() ||
+		_name.size() - separator > 10 ||
+		!all_of(_name.begin() + static_cast<ptrdiff_t>(separator) + 1, _name.end(), [](char _c) { return isdigit(_c); })
+	)
+		return nullopt;
+	return pair<string, unsigned>{_name.substr(0, separator), static_cast<unsigned>(stoul(_name.substr(separator + 1)))};
+}
+
+}
+
+bool BMC::replayFunctionEncoding(FunctionDefinition const& _function, FunctionCall const& _funCall)
+{
+	auto it = m_functionEncodings.find(&_function);
+	if (it == m_functionEncodings.end() || !m_pathConditions.empty() || m_context.solverStackHeigh() == 0)
+		return false;
+	FunctionEncoding const& encoding = it->second;
+	for (auto const& [function, visited]: encoding.callStackQueries)
+		if (visitedFunction(function) != visited)
+			return false;
+	for (auto const& query: encoding.callStackQueries)
+		recordCallStackQuery(*query.first);
+
+	// Temporaries get fresh names, the other variables continue at their current indices.
+	string const temporarySuffix = "." + to_string(m_functionReplays++);
+	map<string, pair<unsigned, unsigned>> currentIndices;
+	for (auto const& [name, symbol]: encoding.symbols)
+		if (symbol.temporary)
+			m_context.recordTemporary(name + temporarySuffix);
+		else
+		{
+			m_context.recordUse(*symbol.variable);
+			currentIndices[name] = {symbol.variable->index(), symbol.variable->nextFreeIndex()};
+		}
+	auto replayedIndex = [&](string const& _name, FunctionEncoding::Symbol const& _symbol, unsigned _index) {
+		auto const& [index, nextFreeIndex] = currentIndices.at(_name);
+		if (_symbol.entryIndex == _index)
+			return index;
+		solAssert(_symbol.changedVariable && _index >= _symbol.firstIndex, "");
+		return _index - _symbol.firstIndex + nextFreeIndex;
+	};
+	auto replayedName = [&](string const& _name) -> optional<string> {
+		auto ssaName = splitSSAName(_name);
+		if (!ssaName)
+			return nullopt;
+		auto const& [uniqueName, index] = *ssaName;
+		auto const& symbol = encoding.symbols.at(uniqueName);
+		if (symbol.temporary)
+			return uniqueName + temporarySuffix + "_" + to_string(index);
+		return uniqueName + "_" + to_string(replayedIndex(uniqueName, symbol, index));
+	};
+
+	map<string, smtutil::Expression> replayedLeaves;
+	map<void const*, smtutil::Expression> replayedTerms;
+	function<smtutil::Expression(smtutil::Expression const&)> replay = [&](smtutil::Expression const& _expr) {
+		if (_expr.arguments.empty())
+		{
+			if (_expr.sort->kind == smtutil::Kind::Sort)
+				return _expr;
+			if (auto leaf = replayedLeaves.find(_expr.name); leaf != replayedLeaves.end())
+				return leaf->second;
+			auto name = replayedName(_expr.name);
+			smtutil::Expression result = name ? m_context.newVariable(*name, _expr.sort) : _expr;
+			replayedLeaves.emplace(_expr.name, result);
+			return result;
+		}
+		if (auto term = replayedTerms.find(_expr.arguments.storage()); term != replayedTerms.end())
+			return term->second;
+		vector<smtutil::Expression> arguments;
+		vector<smtutil::SortPointer> domain;
+		for (auto const& argument: _expr.arguments)
+		{
+			arguments.push_back(replay(argument));
+			domain.push_back(arguments.back().sort);
+		}
+		optional<string> name;
+		if (_expr.op() == smtutil::Operator::None)
+			name = replayedName(_expr.name);
+		smtutil::Expression result = name ?
+			m_context.newVariable(*name, make_shared<smtutil::FunctionSort>(move(domain), _expr.sort))(move(arguments)) :
+			_expr.withArguments(move(arguments));
+		replayedTerms.emplace(_expr.arguments.storage(), result);
+		return result;
+	};
+
+	smtutil::Expression assertionsBefore = m_context.assertions();
+	vector<ModelKey> modelKeys;
+	pair<vector<smtutil::Expression>, vector<string>> modelBefore;
+	if (!encoding.targets.empty())
+		modelBefore = modelExpressions(&modelKeys);
+	map<ModelKey, size_t> modelIndices;
+	for (size_t i = 0; i < modelKeys.size(); ++i)
+		modelIndices.emplace(modelKeys[i], i);
+
+	for (auto const& assertion: encoding.assertions)
+		m_context.addAssertion(replay(assertion));
+
+	for (auto const& target: encoding.targets)
+	{
+		smtutil::Expression assertions = assertionsBefore;
+		for (auto assertion = target.assertions.rbegin(); assertion != target.assertions.rend(); ++assertion)
+			assertions = replay(*assertion) && move(assertions);
+		smtutil::Expression pathConditions = replay(target.pathConditions);
+
+		vector<CallStackEntry> callStack = m_callStack;
+		callStack.emplace_back(&_function, &_funCall);
+		callStack += target.callStack;
+
+		// The model of the target is the one at the call, updated by the target.
+		vector<ModelKey> keys;
+		pair<vector<smtutil::Expression>, vector<string>> model;
+		auto addToModel = [&](ModelKey const& _key, string _name) {
+			auto value = target.model.find(_key);
+			model.first.push_back(value != target.model.end() ? replay(value->second) : modelBefore.first.at(modelIndices.at(_key)));
+			model.second.push_back(move(_name));
+			keys.push_back(_key);
+		};
+		set<Expression const*> uninterpretedTerms = target.uninterpretedTerms;
+		for (size_t i = 0; i < modelKeys.size(); ++i)
+			if (auto term = get_if<Expression const*>(&modelKeys[i]))
+				uninterpretedTerms.insert(*term);
+			else
+				addToModel(modelKeys[i], modelBefore.second[i]);
+		for (auto const& uf: uninterpretedTerms)
+			if (uf->annotation().type->isValueType())
+				addToModel(uf, uf->location().text());
+
+		BMCVerificationTarget replayedTarget{
+			{
+				target.type,
+				replay(target.value),
+				pathConditions && assertions
+			},
+			target.expression,
+			move(callStack),
+			move(model)
+		};
+		// The terms that the call added so far, for the recordings of the callers.
+		m_uninterpretedTerms += target.uninterpretedTerms;
+		recordVerificationTarget(replayedTarget, pathConditions, assertions, keys);
+		m_verificationTargets.emplace_back(move(replayedTarget));
+	}
+
+	for (auto const& [name, symbol]: encoding.symbols)
+		if (symbol.changedVariable)
+			symbol.changedVariable->setIndices(
+				replayedIndex(name, symbol, symbol.exitIndex),
+				symbol.exitNextFreeIndex - symbol.firstIndex + currentIndices.at(name).second
+			);
+
+	m_uninterpretedTerms += encoding.uninterpretedTerms;
+	m_loopExecutionHappened = m_loopExecutionHappened || encoding.loopExecutionHappened;
+	m_externalFunctionCallHappened = m_externalFunctionCallHappened || encoding.externalFunctionCallHappened;
+	m_arrayAssignmentHappened = m_arrayAssignmentHappened || encoding.arrayAssignmentHappened;
+	return true;
+}
+
+bool BMC::startFunctionRecording()
+{
+	// Path conditions are part of the encoding of a call,
+	// so only calls outside of branches are recorded.
+	if (!m_pathConditions.empty() || m_context.solverStackHeigh() == 0)
+		return false;
+
+	FunctionRecording recording;
+	recording.callStackSize = m_callStack.size();
+	recording.solverStackHeight = m_context.solverStackHeigh();
+	recording.assertions = m_context.assertions();
+	recording.errors = m_errorReporter.errors().size();
+	recording.callerUninterpretedTerms = exchange(m_uninterpretedTerms, {});
+	recording.callerLoopExecutionHappened = exchange(m_loopExecutionHappened, false);
+	recording.callerExternalFunctionCallHappened = exchange(m_externalFunctionCallHappened, false);
+	recording.callerArrayAssignmentHappened = exchange(m_arrayAssignmentHappened, false);
+	m_functionRecordings.emplace_back(move(recording));
+	m_context.startRecording();
+	return true;
+}
+
+void BMC::stopFunctionRecording(FunctionDefinition const& _function)
+{
+	solAssert(!m_functionRecordings.empty(), "");
+	FunctionRecording recording = move(m_functionRecordings.back());
+	m_functionRecordings.pop_back();
+	smt::EncodingContext::Recording symbols = m_context.stopRecording();
+
+	FunctionEncoding& encoding = recording.encoding;
+	encoding.uninterpretedTerms = m_uninterpretedTerms;
+	encoding.loopExecutionHappened = m_loopExecutionHappened;
+	encoding.externalFunctionCallHappened = m_externalFunctionCallHappened;
+	encoding.arrayAssignmentHappened = m_arrayAssignmentHappened;
+	m_uninterpretedTerms += recording.callerUninterpretedTerms;
+	m_loopExecutionHappened = m_loopExecutionHappened || recording.callerLoopExecutionHappened;
+	m_externalFunctionCallHappened = m_externalFunctionCallHappened || recording.callerExternalFunctionCallHappened;
+	m_arrayAssignmentHappened = m_arrayAssignmentHappened || recording.callerArrayAssignmentHappened;
+
+	// Warnings would not be reported again by a replay.
+	if (
+		!recording.replayable ||
+		!symbols.replayable ||
+		m_errorReporter.errors().size() != recording.errors ||
+		m_context.solverStackHeigh() != recording.solverStackHeight
+	)
+		return;
+	auto assertions = assertionsSince(m_context.assertions(), recording.assertions);
+	if (!assertions)
+		return;
+	encoding.assertions.assign(assertions->rbegin(), assertions->rend());
+
+	for (auto const& record: symbols.destroyedSymbols)
+	{
+		// A variable that existed before the call might not exist at a later call.
+		if (!record.created)
+			return;
+		FunctionEncoding::Symbol symbol;
+		symbol.temporary = true;
+		if (!encoding.symbols.emplace(record.name, move(symbol)).second)
+			return;
+	}
+	for (auto const& [variable, record]: symbols.symbols)
+	{
+		FunctionEncoding::Symbol symbol;
+		symbol.variable = variable;
+		symbol.changedVariable = record.changedVariable;
+		if (!record.created)
+		{
+			symbol.entryIndex = record.index;
+			symbol.firstIndex = record.nextFreeIndex;
+		}
+		symbol.exitIndex = variable->index();
+		symbol.exitNextFreeIndex = variable->nextFreeIndex();
+		if (symbol.exitIndex < symbol.firstIndex && symbol.entryIndex != symbol.exitIndex)
+			return;
+		if (!encoding.symbols.emplace(record.name, move(symbol)).second)
+			return;
+	}
+
+	// The encoding can only refer to the values of the variables before the call
+	// and to the values it assigns itself.
+	set<void const*> checkedTerms;
+	function<bool(smtutil::Expression const&)> replayable = [&](smtutil::Expression const& _expr) {
+		if (!_expr.arguments.empty() && !checkedTerms.insert(_expr.arguments.storage()).second)
+			return true;
+		if (
+			(_expr.arguments.empty() && _expr.sort->kind != smtutil::Kind::Sort) ||
+			(!_expr.arguments.empty() && _expr.op() == smtutil::Operator::None)
+		)
+		{
+			auto ssaName = splitSSAName(_expr.name);
+			if (!ssaName)
+			{
+				// Constants are not renamed.
+				if (!_expr.arguments.empty())
+					return false;
+			}
+			else
+			{
+				auto symbol = encoding.symbols.find(ssaName->first);
+				if (symbol == encoding.symbols.end())
+					return false;
+				if (
+					!symbol->second.temporary &&
+					symbol->second.entryIndex != ssaName->second &&
+					!(symbol->second.changedVariable && ssaName->second >= symbol->second.firstIndex)
+				)
+					return false;
+			}
+		}
+		for (auto const& argument: _expr.arguments)
+			if (!replayable(argument))
+				return false;
+		return true;
+	};
+	for (auto const& assertion: encoding.assertions)
+		if (!replayable(assertion))
+			return;
+	for (auto const& target: encoding.targets)
+	{
+		if (!replayable(target.value) || !replayable(target.pathConditions))
+			return;
+		for (auto const& assertion: target.assertions)
+			if (!replayable(assertion))
+				return;
+		for (auto const& value: target.model)
+			if (!replayable(value.second))
+				return;
+	}
+
+	m_functionEncodings[&_function] = move(encoding);
+}
+
+void BMC::recordCallStackQuery(FunctionDefinition const& _function)
+{
+	auto isFunction = [&](CallStackEntry const& _entry) { return _entry.first == &_function; };
+	for (auto& recording: m_functionRecordings)
+	{
+		auto callStackBelow = m_callStack.begin() + static_cast<ptrdiff_t>(recording.callStackSize);
+		// The calls above are the same for every replay.
+		if (any_of(callStackBelow, m_callStack.end(), isFunction))
+			continue;
+		recording.encoding.callStackQueries[&_function] = any_of(m_callStack.begin(), callStackBelow, isFunction);
+	}
+}
+
+void BMC::recordVerificationTarget(
+	BMCVerificationTarget const& _target,
+	smtutil::Expression const& _pathConditions,
+	smtutil::Expression const& _assertions,
+	vector<ModelKey> const& _modelKeys
+)
+{
+	solAssert(_modelKeys.size() == _target.modelExpressions.first.size(), "");
+	for (auto recording = m_functionRecordings.begin(); recording != m_functionRecordings.end(); ++recording)
+	{
+		auto assertions = assertionsSince(_assertions, recording->assertions);
+		// Constant conditions are checked right away.
+		if (_target.type == VerificationTarget::Type::ConstantCondition || !assertions)
+		{
+			recording->replayable = false;
+			continue;
+		}
+
+		FunctionEncoding::Target target{
+			_target.type,
+			_target.value,
+			_pathConditions,
+			move(*assertions),
+			_target.expression,
+			vector<CallStackEntry>(
+				_target.callStack.begin() + static_cast<ptrdiff_t>(recording->callStackSize) + 1,
+				_target.callStack.end()
+			),
+			m_uninterpretedTerms,
+			{}
+		};
+		for (auto inner = next(recording); inner != m_functionRecordings.end(); ++inner)
+			target.uninterpretedTerms += inner->callerUninterpretedTerms;
+		for (size_t i = 0; i < _modelKeys.size(); ++i)
+			target.model.emplace(_modelKeys[i], _target.modelExpressions.first[i]);
+		recording->encoding.targets.emplace_back(move(target));
+	}
+}
+
+optional<vector<smtutil::Expression>> BMC::assertionsSince(
+	smtutil::Expression const& _assertions,
+	smtutil::Expression const& _base
+)
+{
+	auto same = [](smtutil::Expression const& _a, smtutil::Expression const& _b) {
+		return _a.name == _b.name && _a.sort == _b.sort && _a.arguments.storage() == _b.arguments.storage();
+	};
+	vector<smtutil::Expression> assertions;
+	smtutil::Expression const* current = &_assertions;
+	while (!same(*current, _base))
+	{
+		if (current->op() != smtutil::Operator::And)
+			return nullopt;
+		assertions.push_back(current->arguments.at(0));
+		current = &current->arguments.at(1);
+	}
+	return assertions;
+}
+
 /// Solving.
 
 void BMC::checkCondition(
@@ -814,9 +1242,6 @@ void BMC::checkCondition(
 	smtutil::Expression const* _additionalValue
 )
 {
-	m_interface->push();
-	m_interface->addAssertion(_condition);
-
 	vector<smtutil::Expression> expressionsToEvaluate;
 	vector<string> expressionNames;
 	tie(expressionsToEvaluate, expressionNames) = _modelExpressions;
@@ -828,7 +1253,7 @@ void BMC::checkCondition(
 		}
 	smtutil::CheckResult result;
 	vector<string> values;
-	tie(result, values) = checkSatisfiableAndGenerateModel(expressionsToEvaluate);
+	tie(result, values) = checkSatisfiableAndGenerateModel(_condition, expressionsToEvaluate);
 
 	string extraComment = SMTEncoder::extraComment();
 	if (m_loopExecutionHappened)
@@ -888,8 +1313,6 @@ void BMC::checkCondition(
 		m_errorReporter.warning(1823_error, _location, "BMC: Error trying to invoke SMT solver.");
 		break;
 	}
-
-	m_interface->pop();
 }
 
 void BMC::checkBooleanNotConstant(
@@ -903,15 +1326,8 @@ void BMC::checkBooleanNotConstant(
 	if (dynamic_cast<Literal const*>(&_condition))
 		return;
 
-	m_interface->push();
-	m_interface->addAssertion(_constraints && _value);
-	auto positiveResult = checkSatisfiable();
-	m_interface->pop();
-
-	m_interface->push();
-	m_interface->addAssertion(_constraints && !_value);
-	auto negatedResult = checkSatisfiable();
-	m_interface->pop();
+	auto positiveResult = checkSatisfiable(_constraints && _value);
+	auto negatedResult = checkSatisfiable(_constraints && !_value);
 
 	if (positiveResult == smtutil::CheckResult::ERROR || negatedResult == smtutil::CheckResult::ERROR)
 		m_errorReporter.warning(8592_error, _condition.location(), "Error trying to invoke SMT solver.");
@@ -951,13 +1367,16 @@ void BMC::checkBooleanNotConstant(
 }
 
 pair<smtutil::CheckResult, vector<string>>
-BMC::checkSatisfiableAndGenerateModel(vector<smtutil::Expression> const& _expressionsToEvaluate)
+BMC::checkSatisfiableAndGenerateModel(
+	smtutil::Expression const& _condition,
+	vector<smtutil::Expression> const& _expressionsToEvaluate
+)
 {
 	smtutil::CheckResult result;
 	vector<string> values;
 	try
 	{
-		tie(result, values) = m_interface->check(_expressionsToEvaluate);
+		tie(result, values) = m_interface->checkAssuming({_condition}, _expressionsToEvaluate);
 	}
 	catch (smtutil::SolverError const& _e)
 	{
@@ -981,8 +1400,8 @@ BMC::checkSatisfiableAndGenerateModel(vector<smtutil::Expression> const& _expres
 	return make_pair(result, values);
 }
 
-smtutil::CheckResult BMC::checkSatisfiable()
+smtutil::CheckResult BMC::checkSatisfiable(smtutil::Expression const& _condition)
 {
-	return checkSatisfiableAndGenerateModel({}).first;
+	return checkSatisfiableAndGenerateModel(_condition, {}).first;
 }
 
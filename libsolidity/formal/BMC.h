@@ -34,11 +34,15 @@
 
 #include <libsolidity/interface/ReadFile.h>
 
+#include <libsmtutil/SMTQueryCache.h>
 #include <libsmtutil/SolverInterface.h>
 #include <liblangutil/ErrorReporter.h>
 
+#include <map>
+#include <optional>
 #include <set>
 #include <string>
+#include <variant>
 #include <vector>
 
 using solidity::util::h256;
@@ -61,7 +65,9 @@ public:
 		langutil::ErrorReporter& _errorReporter,
 		std::map<h256, std::string> const& _smtlib2Responses,
 		ReadCallback::Callback const& _smtCallback,
-		smtutil::SMTSolverChoice _enabledSolvers
+		smtutil::SMTSolverChoice _enabledSolvers,
+		smtutil::SMTPortfolioMode _portfolioMode,
+		smtutil::SMTQueryCache* _queryCache
 	);
 
 	void analyze(SourceUnit const& _sources, std::map<ASTNode const*, std::set<VerificationTarget::Type>> _solvedTargets);
@@ -98,6 +104,8 @@ private:
 	void visitAddMulMod(FunctionCall const& _funCall) override;
 	/// Visits the FunctionDefinition of the called function
 	/// if available and inlines the return value.
+	/// Replays the encoding of the function from a previous call instead
+	/// of visiting it again if possible.
 	void inlineFunctionCall(FunctionCall const& _funCall);
 	/// Creates an uninterpreted function call.
 	void abstractFunctionCall(FunctionCall const& _funCall);
@@ -117,7 +125,11 @@ private:
 	void resetStorageReferences();
 	void reset();
 
-	std::pair<std::vector<smtutil::Expression>, std::vector<std::string>> modelExpressions();
+	/// The variable, special variable or uninterpreted term that a model expression stands for.
+	using ModelKey = std::variant<VariableDeclaration const*, std::string, Expression const*>;
+	/// @returns the expressions to evaluate for a counterexample and their names.
+	/// If @a _keys is given, the keys of the expressions are stored there.
+	std::pair<std::vector<smtutil::Expression>, std::vector<std::string>> modelExpressions(std::vector<ModelKey>* _keys = nullptr);
 	//@}
 
 	/// Verification targets.
@@ -129,11 +141,14 @@ private:
 		std::pair<std::vector<smtutil::Expression>, std::vector<std::string>> modelExpressions;
 	};
 
+	/// Checks the collected targets. @a _constraints are the assertions at the end
+	/// of the function, which underflow and overflow targets are checked against.
+	/// They are added to the solver once for all of these targets.
 	void checkVerificationTargets(smtutil::Expression const& _constraints);
-	void checkVerificationTarget(BMCVerificationTarget& _target, smtutil::Expression const& _constraints = smtutil::Expression(true));
+	void checkVerificationTarget(BMCVerificationTarget& _target);
 	void checkConstantCondition(BMCVerificationTarget& _target);
-	void checkUnderflow(BMCVerificationTarget& _target, smtutil::Expression const& _constraints);
-	void checkOverflow(BMCVerificationTarget& _target, smtutil::Expression const& _constraints);
+	void checkUnderflow(BMCVerificationTarget& _target);
+	void checkOverflow(BMCVerificationTarget& _target);
 	void checkDivByZero(BMCVerificationTarget& _target);
 	void checkBalance(BMCVerificationTarget& _target);
 	void checkAssert(BMCVerificationTarget& _target);
@@ -144,6 +159,100 @@ private:
 	);
 	//@}
 
+	/// Function encodings.
+	//@{
+	/// The encoding of an inlined function call, with the symbols it uses.
+	/// Later calls of the function replay it under fresh SSA indices
+	/// instead of visiting the function again.
+	struct FunctionEncoding
+	{
+		/// A symbolic variable the encoding refers to.
+		struct Symbol
+		{
+			/// The variable, null for temporaries.
+			smt::SymbolicVariable const* variable = nullptr;
+			/// The variable, if the encoding changes its index.
+			smt::SymbolicVariable* changedVariable = nullptr;
+			/// Whether the variable only exists during the call, so that
+			/// a replay uses fresh names for it.
+			bool temporary = false;
+			/// The index of the variable before the call, if it existed.
+			std::optional<unsigned> entryIndex;
+			/// The first index allocated during the call.
+			unsigned firstIndex = 0;
+			/// The indices after the call.
+			unsigned exitIndex = 0;
+			unsigned exitNextFreeIndex = 0;
+		};
+		struct Target
+		{
+			VerificationTarget::Type type;
+			smtutil::Expression value;
+			smtutil::Expression pathConditions;
+			/// Assertions added since the call started, latest first.
+			std::vector<smtutil::Expression> assertions;
+			Expression const* expression;
+			/// Part of the callstack above the entry of the call.
+			std::vector<CallStackEntry> callStack;
+			std::set<Expression const*> uninterpretedTerms;
+			std::map<ModelKey, smtutil::Expression> model;
+		};
+
+		/// Whether the functions were in the callstack below the call.
+		std::map<FunctionDefinition const*, bool> callStackQueries;
+		/// Symbols by their unique name.
+		std::map<std::string, Symbol> symbols;
+		/// Assertions added by the call, in order.
+		std::vector<smtutil::Expression> assertions;
+		std::vector<Target> targets;
+		std::set<Expression const*> uninterpretedTerms;
+		bool loopExecutionHappened = false;
+		bool externalFunctionCallHappened = false;
+		bool arrayAssignmentHappened = false;
+	};
+	/// A function call whose encoding is being recorded.
+	struct FunctionRecording
+	{
+		size_t callStackSize = 0;
+		unsigned solverStackHeight = 0;
+		/// Assertions before the call.
+		smtutil::Expression assertions = smtutil::Expression(true);
+		size_t errors = 0;
+		/// False if the encoding cannot be replayed.
+		bool replayable = true;
+		FunctionEncoding encoding;
+		/// State of the caller, restored after the call.
+		std::set<Expression const*> callerUninterpretedTerms;
+		bool callerLoopExecutionHappened = false;
+		bool callerExternalFunctionCallHappened = false;
+		bool callerArrayAssignmentHappened = false;
+	};
+
+	/// Replays the encoding of a previous call of @a _function at @a _funCall,
+	/// whose arguments are already initialized.
+	/// @returns false if there is no encoding that can be replayed here.
+	bool replayFunctionEncoding(FunctionDefinition const& _function, FunctionCall const& _funCall);
+	/// Starts recording the encoding of a function call that is about to be visited.
+	/// @returns false if the encoding of the call is not recorded.
+	bool startFunctionRecording();
+	/// Stops the recording of a call of @a _function and stores the encoding if it can be replayed.
+	void stopFunctionRecording(FunctionDefinition const& _function);
+	void recordCallStackQuery(FunctionDefinition const& _function) override;
+	/// Adds a verification target to the active recordings.
+	void recordVerificationTarget(
+		BMCVerificationTarget const& _target,
+		smtutil::Expression const& _pathConditions,
+		smtutil::Expression const& _assertions,
+		std::vector<ModelKey> const& _modelKeys
+	);
+	/// @returns the expressions that were added to @a _base by EncodingContext::addAssertion
+	/// to obtain @a _assertions, latest first, or nullopt if there are none such.
+	static std::optional<std::vector<smtutil::Expression>> assertionsSince(
+		smtutil::Expression const& _assertions,
+		smtutil::Expression const& _base
+	);
+	//@}
+
 	/// Solver related.
 	//@{
 	/// Check that a condition can be satisfied.
@@ -166,10 +275,16 @@ private:
 		smtutil::Expression const& _value,
 		std::vector<CallStackEntry> const& _callStack
 	);
+	/// Checks whether @a _condition is satisfiable together with the assertions of the solver.
+	/// The condition is passed to the solver as an assumption, so that the terms that
+	/// subsequent queries share, like the path conditions, are not encoded again.
 	std::pair<smtutil::CheckResult, std::vector<std::string>>
-	checkSatisfiableAndGenerateModel(std::vector<smtutil::Expression> const& _expressionsToEvaluate);
+	checkSatisfiableAndGenerateModel(
+		smtutil::Expression const& _condition,
+		std::vector<smtutil::Expression> const& _expressionsToEvaluate
+	);
 
-	smtutil::CheckResult checkSatisfiable();
+	smtutil::CheckResult checkSatisfiable(smtutil::Expression const& _condition);
 	//@}
 
 	std::unique_ptr<smtutil::SolverInterface> m_interface;
@@ -183,6 +298,13 @@ private:
 
 	std::vector<BMCVerificationTarget> m_verificationTargets;
 
+	/// Encodings of inlined function calls in the current contract.
+	std::map<FunctionDefinition const*, FunctionEncoding> m_functionEncodings;
+	/// Active recordings, innermost last.
+	std::vector<FunctionRecording> m_functionRecordings;
+	/// Number of replayed encodings, used to give their temporaries unique names.
+	unsigned m_functionReplays = 0;
+
 	/// Targets that were already proven.
 	std::map<ASTNode const*, std::set<VerificationTarget::Type>> m_solvedTargets;
 };
@@ -34,7 +34,9 @@
 
 #include <boost/range/adaptor/reversed.hpp>
 
+#include <atomic>
 #include <queue>
+#include <thread>
 
 using namespace std;
 using namespace solidity;
@@ -49,11 +51,15 @@ CHC::CHC(
 	ErrorReporter& _errorReporter,
 	[[maybe_unused]] map<util::h256, string> const& _smtlib2Responses,
 	[[maybe_unused]] ReadCallback::Callback const& _smtCallback,
-	SMTSolverChoice _enabledSolvers
+	SMTSolverChoice _enabledSolvers,
+	[[maybe_unused]] SMTQueryCache* _queryCache,
+	unsigned _workers
 ):
 	SMTEncoder(_context),
 	m_outerErrorReporter(_errorReporter),
-	m_enabledSolvers(_enabledSolvers)
+	m_enabledSolvers(_enabledSolvers),
+	m_queryCache(_queryCache),
+	m_workers(_workers)
 {
 	bool usesZ3 = _enabledSolvers.z3;
 #ifndef HAVE_Z3
@@ -737,7 +743,7 @@ void CHC::resetSourceAnalysis()
 	if (usesZ3)
 	{
 		/// z3::fixedpoint does not have a reset mechanism, so we need to create another.
-		m_interface.reset(new Z3CHCInterface());
+		m_interface.reset(new Z3CHCInterface(m_queryCache));
 		auto z3Interface = dynamic_cast<Z3CHCInterface const*>(m_interface.get());
 		solAssert(z3Interface, "");
 		m_context.setSolver(z3Interface->z3Interface());
@@ -1099,44 +1105,30 @@ void CHC::addRule(smtutil::Expression const& _rule, string const& _ruleName)
 	m_interface->addRule(_rule, _ruleName);
 }
 
-pair<CheckResult, CHCSolverInterface::CexGraph> CHC::query(smtutil::Expression const& _query, langutil::SourceLocation const& _location)
+pair<CheckResult, CHCSolverInterface::CexGraph> CHC::query(CHCSolverInterface& _interface, smtutil::Expression const& _query)
 {
 	CheckResult result;
 	CHCSolverInterface::CexGraph cex;
-	tie(result, cex) = m_interface->query(_query);
-	switch (result)
-	{
-	case CheckResult::SATISFIABLE:
-	{
+	tie(result, cex) = _interface.query(_query);
 #ifdef HAVE_Z3
+	if (result == CheckResult::SATISFIABLE)
+	{
 		// Even though the problem is SAT, Spacer's pre processing makes counterexamples incomplete.
 		// We now disable those optimizations and check whether we can still solve the problem.
-		auto* spacer = dynamic_cast<Z3CHCInterface*>(m_interface.get());
+		auto* spacer = dynamic_cast<Z3CHCInterface*>(&_interface);
 		solAssert(spacer, "");
 		spacer->setSpacerOptions(false);
 
 		CheckResult resultNoOpt;
 		CHCSolverInterface::CexGraph cexNoOpt;
-		tie(resultNoOpt, cexNoOpt) = m_interface->query(_query);
+		tie(resultNoOpt, cexNoOpt) = _interface.query(_query);
 
 		if (resultNoOpt == CheckResult::SATISFIABLE)
 			cex = move(cexNoOpt);
 
 		spacer->setSpacerOptions(true);
-#endif
-		break;
-	}
-	case CheckResult::UNSATISFIABLE:
-		break;
-	case CheckResult::UNKNOWN:
-		break;
-	case CheckResult::CONFLICTING:
-		m_outerErrorReporter.warning(1988_error, _location, "CHC: At least two SMT solvers provided conflicting answers. Results might not be sound.");
-		break;
-	case CheckResult::ERROR:
-		m_outerErrorReporter.warning(1218_error, _location, "CHC: Error trying to invoke SMT solver.");
-		break;
 	}
+#endif
 	return {result, cex};
 }
 
@@ -1182,6 +1174,7 @@ void CHC::addAssertVerificationTarget(ASTNode const* _scope, smtutil::Expression
 
 void CHC::checkVerificationTargets()
 {
+	m_queries.clear();
 	for (auto const& [scope, target]: m_verificationTargets)
 	{
 		if (target.type == VerificationTarget::Type::Assert)
@@ -1255,6 +1248,9 @@ void CHC::checkVerificationTargets()
 			}
 		}
 	}
+
+	if (!m_queries.empty())
+		solveQueriesConcurrently();
 }
 
 void CHC::checkAssertTarget(ASTNode const* _scope, CHCVerificationTarget const& _target)
@@ -1285,36 +1281,102 @@ void CHC::checkAndReportTarget(
 
 	createErrorBlock();
 	connectBlocks(_target.value, error(), _target.constraints && (_target.errorId == _errorId));
-	auto const& [result, model] = query(error(), _scope->location());
+
+	CHCQuery chcQuery{_scope, _target.type, _errorReporterId, move(_satMsg), move(_unknownMsg), error()};
+	bool concurrent = false;
+#ifdef HAVE_Z3
+	concurrent = m_workers > 1 && dynamic_cast<Z3CHCInterface*>(m_interface.get());
+#endif
+	if (concurrent)
+		m_queries.emplace_back(move(chcQuery));
+	else
+		reportQuery(chcQuery, query(*m_interface, chcQuery.error));
+}
+
+void CHC::reportQuery(CHCQuery const& _query, pair<CheckResult, CHCSolverInterface::CexGraph> const& _result)
+{
+	// Deferred queries are all created before any of them is answered.
+	if (m_unsafeTargets.count(_query.scope) && m_unsafeTargets.at(_query.scope).count(_query.type))
+		return;
+
+	auto const& [result, model] = _result;
+	auto const& location = _query.scope->location();
+	if (result == CheckResult::CONFLICTING)
+		m_outerErrorReporter.warning(1988_error, location, "CHC: At least two SMT solvers provided conflicting answers. Results might not be sound.");
+	else if (result == CheckResult::ERROR)
+		m_outerErrorReporter.warning(1218_error, location, "CHC: Error trying to invoke SMT solver.");
+
 	if (result == CheckResult::UNSATISFIABLE)
-		m_safeTargets[_scope].insert(_target.type);
+		m_safeTargets[_query.scope].insert(_query.type);
 	else if (result == CheckResult::SATISFIABLE)
 	{
-		solAssert(!_satMsg.empty(), "");
-		m_unsafeTargets[_scope].insert(_target.type);
-		auto cex = generateCounterexample(model, error().name);
+		solAssert(!_query.satMsg.empty(), "");
+		m_unsafeTargets[_query.scope].insert(_query.type);
+		auto cex = generateCounterexample(model, _query.error.name);
 		if (cex)
 			m_outerErrorReporter.warning(
-				_errorReporterId,
-				_scope->location(),
-				"CHC: " + _satMsg,
+				_query.errorReporterId,
+				location,
+				"CHC: " + _query.satMsg,
 				SecondarySourceLocation().append("\nCounterexample:\n" + *cex, SourceLocation{})
 			);
 		else
 			m_outerErrorReporter.warning(
-				_errorReporterId,
-				_scope->location(),
-				"CHC: " + _satMsg
+				_query.errorReporterId,
+				location,
+				"CHC: " + _query.satMsg
 			);
 	}
-	else if (!_unknownMsg.empty())
+	else if (!_query.unknownMsg.empty())
 		m_outerErrorReporter.warning(
-			_errorReporterId,
-			_scope->location(),
-			"CHC: " + _unknownMsg
+			_query.errorReporterId,
+			location,
+			"CHC: " + _query.unknownMsg
 		);
 }
 
+void CHC::solveQueriesConcurrently()
+{
+	vector<pair<CheckResult, CHCSolverInterface::CexGraph>> results(m_queries.size());
+#ifdef HAVE_Z3
+	auto* spacer = dynamic_cast<Z3CHCInterface*>(m_interface.get());
+	solAssert(spacer, "");
+
+	// Every worker gets its own copy of the Horn problem in its own Z3 context.
+	// The copies have to be created here, since Z3's global parameters are not thread-safe.
+	vector<unique_ptr<Z3CHCInterface>> copies;
+	for (size_t i = 0; i < min<size_t>(m_workers, m_queries.size()); ++i)
+		copies.emplace_back(spacer->fork());
+
+	atomic<size_t> nextQuery{0};
+	vector<exception_ptr> exceptions(copies.size());
+	vector<thread> workers;
+	for (size_t i = 0; i < copies.size(); ++i)
+		workers.emplace_back([&, i]() {
+			try
+			{
+				for (size_t index = nextQuery++; index < m_queries.size(); index = nextQuery++)
+					results[index] = query(*copies[i], m_queries[index].error);
+			}
+			catch (...)
+			{
+				exceptions[i] = current_exception();
+			}
+		});
+	for (auto& worker: workers)
+		worker.join();
+	for (auto const& exception: exceptions)
+		if (exception)
+			rethrow_exception(exception);
+#else
+	solAssert(false, "");
+#endif
+
+	for (size_t i = 0; i < m_queries.size(); ++i)
+		reportQuery(m_queries[i], results[i]);
+	m_queries.clear();
+}
+
 /**
 The counterexample DAG has the following properties:
 1) The root node represents the reachable error predicate.
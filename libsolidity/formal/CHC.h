@@ -37,6 +37,7 @@
 #include <libsolidity/interface/ReadFile.h>
 
 #include <libsmtutil/CHCSolverInterface.h>
+#include <libsmtutil/SMTQueryCache.h>
 
 #include <boost/algorithm/string/join.hpp>
 
@@ -55,7 +56,9 @@ public:
 		langutil::ErrorReporter& _errorReporter,
 		std::map<util::h256, std::string> const& _smtlib2Responses,
 		ReadCallback::Callback const& _smtCallback,
-		smtutil::SMTSolverChoice _enabledSolvers
+		smtutil::SMTSolverChoice _enabledSolvers,
+		smtutil::SMTQueryCache* _queryCache,
+		unsigned _workers = 1
 	);
 
 	void analyze(SourceUnit const& _sources);
@@ -179,7 +182,10 @@ private:
 	void addRule(smtutil::Expression const& _rule, std::string const& _ruleName);
 	/// @returns <true, empty> if query is unsatisfiable (safe).
 	/// @returns <false, model> otherwise.
-	std::pair<smtutil::CheckResult, smtutil::CHCSolverInterface::CexGraph> query(smtutil::Expression const& _query, langutil::SourceLocation const& _location);
+	static std::pair<smtutil::CheckResult, smtutil::CHCSolverInterface::CexGraph> query(
+		smtutil::CHCSolverInterface& _interface,
+		smtutil::Expression const& _query
+	);
 
 	void addVerificationTarget(ASTNode const* _scope, VerificationTarget::Type _type, smtutil::Expression _from, smtutil::Expression _constraints, smtutil::Expression _errorId);
 	void addVerificationTarget(ASTNode const* _scope, VerificationTarget::Type _type, smtutil::Expression _errorId);
@@ -189,6 +195,8 @@ private:
 	// Forward declaration. Definition is below.
 	struct CHCVerificationTarget;
 	void checkAssertTarget(ASTNode const* _scope, CHCVerificationTarget const& _target);
+	/// Creates the query for the target. The query is answered and reported immediately
+	/// in sequential mode, otherwise it is deferred to solveQueriesConcurrently.
 	void checkAndReportTarget(
 		ASTNode const* _scope,
 		CHCVerificationTarget const& _target,
@@ -197,6 +205,13 @@ private:
 		std::string _satMsg,
 		std::string _unknownMsg = ""
 	);
+	// Forward declaration. Definition is below.
+	struct CHCQuery;
+	/// Records the result of @a _query and reports it.
+	void reportQuery(CHCQuery const& _query, std::pair<smtutil::CheckResult, smtutil::CHCSolverInterface::CexGraph> const& _result);
+	/// Answers the deferred queries on m_workers copies of the Horn problem
+	/// and reports the results in the order the queries were created.
+	void solveQueriesConcurrently();
 
 	std::optional<std::string> generateCounterexample(smtutil::CHCSolverInterface::CexGraph const& _graph, std::string const& _root);
 
@@ -283,6 +298,20 @@ private:
 	std::map<ASTNode const*, std::set<VerificationTarget::Type>> m_safeTargets;
 	/// Targets proven unsafe.
 	std::map<ASTNode const*, std::set<VerificationTarget::Type>> m_unsafeTargets;
+
+	struct CHCQuery
+	{
+		ASTNode const* scope;
+		VerificationTarget::Type type;
+		langutil::ErrorId errorReporterId;
+		std::string satMsg;
+		std::string unknownMsg;
+		/// The error predicate whose reachability is queried.
+		smtutil::Expression error;
+	};
+
+	/// Queries deferred to solveQueriesConcurrently.
+	std::vector<CHCQuery> m_queries;
 	//@}
 
 	/// Control-flow.
@@ -321,6 +350,13 @@ private:
 
 	/// SMT solvers that are chosen at runtime.
 	smtutil::SMTSolverChoice m_enabledSolvers;
+
+	/// Persistent cache of Horn query results, if any.
+	smtutil::SMTQueryCache* m_queryCache = nullptr;
+
+	/// Number of copies of the Horn problem that answer the queries concurrently.
+	/// Values below 2 answer them sequentially.
+	unsigned m_workers = 1;
 };
 
 }
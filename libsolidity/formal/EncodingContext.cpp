@@ -137,7 +137,11 @@ void EncodingContext::setUnknownValue(SymbolicVariable& _variable)
 shared_ptr<SymbolicVariable> EncodingContext::expression(frontend::Expression const& _e)
 {
 	if (!knownExpression(_e))
+	{
+		// A replay would use a fresh value where a later visit uses the current one.
+		recordUnreplayable();
 		createExpression(_e);
+	}
 	return m_expressions.at(&_e);
 }
 
@@ -178,6 +182,8 @@ shared_ptr<SymbolicVariable> EncodingContext::globalSymbol(string const& _name)
 bool EncodingContext::createGlobalSymbol(string const& _name, frontend::Expression const& _expr)
 {
 	solAssert(!knownGlobalSymbol(_name), "");
+	// A replay would use a fresh value where a later visit uses the current one.
+	recordUnreplayable();
 	auto result = newSymbolicVariable(*_expr.annotation().type, _name, *this);
 	m_globalContext.emplace(_name, result.second);
 	setUnknownValue(*result.second);
@@ -220,3 +226,89 @@ void EncodingContext::addAssertion(smtutil::Expression const& _expr)
 	else
 		m_assertions.back() = _expr && move(m_assertions.back());
 }
+
+/// Recording.
+
+EncodingContext::Recording EncodingContext::stopRecording()
+{
+	solAssert(!m_recordings.empty(), "");
+	Recording recording = move(m_recordings.back());
+	m_recordings.pop_back();
+	return recording;
+}
+
+void EncodingContext::recordCreation(SymbolicVariable& _variable)
+{
+	for (auto& recording: m_recordings)
+		recording.createdSymbols.emplace(&_variable, &_variable);
+	if (!m_recordings.empty())
+		_variable.m_recorded = true;
+}
+
+void EncodingContext::recordUse(SymbolicVariable const& _variable)
+{
+	for (auto& recording: m_recordings)
+		if (!recording.symbols.count(&_variable))
+		{
+			SymbolRecord record;
+			record.variable = &_variable;
+			record.name = _variable.m_uniqueName;
+			auto created = recording.createdSymbols.find(&_variable);
+			if (created != recording.createdSymbols.end())
+			{
+				record.changedVariable = created->second;
+				record.created = true;
+			}
+			record.index = _variable.index();
+			record.nextFreeIndex = _variable.nextFreeIndex();
+			recording.symbols.emplace(&_variable, move(record));
+		}
+	if (!m_recordings.empty())
+		_variable.m_recorded = true;
+}
+
+void EncodingContext::recordChange(SymbolicVariable& _variable)
+{
+	recordUse(_variable);
+	for (auto& recording: m_recordings)
+		recording.symbols.at(&_variable).changedVariable = &_variable;
+}
+
+void EncodingContext::recordIndexReset(SymbolicVariable& _variable)
+{
+	recordChange(_variable);
+	recordUnreplayable();
+}
+
+void EncodingContext::recordDestruction(SymbolicVariable const& _variable)
+{
+	for (auto& recording: m_recordings)
+	{
+		recording.createdSymbols.erase(&_variable);
+		auto record = recording.symbols.find(&_variable);
+		if (record != recording.symbols.end())
+		{
+			record->second.variable = nullptr;
+			record->second.changedVariable = nullptr;
+			recording.destroyedSymbols.emplace_back(move(record->second));
+			recording.symbols.erase(record);
+		}
+	}
+}
+
+void EncodingContext::recordTemporary(string const& _name)
+{
+	for (auto& recording: m_recordings)
+	{
+		SymbolRecord record;
+		record.name = _name;
+		record.created = true;
+		recording.destroyedSymbols.emplace_back(move(record));
+	}
+}
+
+void EncodingContext::recordUnreplayable()
+{
+	for (auto& recording: m_recordings)
+		recording.replayable = false;
+}
@@ -145,7 +145,61 @@ public:
 
 	SymbolicState& state() { return m_state; }
 
+	/// Recording.
+	//@{
+	/// How a symbolic variable was used while recording.
+	struct SymbolRecord
+	{
+		/// The variable, if it still exists.
+		SymbolicVariable const* variable = nullptr;
+		/// The variable, if its index was changed.
+		SymbolicVariable* changedVariable = nullptr;
+		std::string name;
+		/// Whether the variable was created while recording.
+		bool created = false;
+		/// The index and next free index of the variable when it was first used.
+		unsigned index = 0;
+		unsigned nextFreeIndex = 0;
+	};
+	/// The symbolic variables used by the encoding of a part of the program.
+	struct Recording
+	{
+		std::unordered_map<SymbolicVariable const*, SymbolRecord> symbols;
+		/// Variables that were used and destroyed while recording.
+		std::vector<SymbolRecord> destroyedSymbols;
+		std::unordered_map<SymbolicVariable const*, SymbolicVariable*> createdSymbols;
+		/// False if the indices of a variable were reset, so that an
+		/// SSA index might stand for different values.
+		bool replayable = true;
+	};
+
+	/// Starts recording which symbolic variables are used and changed.
+	/// Recordings can be nested, every active recording sees all uses.
+	/// BMC replays the recorded encoding of an inlined function for
+	/// later calls, with the SSA indices shifted to fresh ones.
+	void startRecording() { m_recordings.emplace_back(); }
+	/// Stops the innermost recording and @returns it.
+	Recording stopRecording();
+	bool recording() const { return !m_recordings.empty(); }
+
+	void recordCreation(SymbolicVariable& _variable);
+	void recordUse(SymbolicVariable const& _variable);
+	void recordChange(SymbolicVariable& _variable);
+	void recordIndexReset(SymbolicVariable& _variable);
+	void recordDestruction(SymbolicVariable const& _variable);
+	/// Records a variable called @a _name that was used and does not exist anymore.
+	/// Used for the renamed temporaries of a replayed encoding.
+	void recordTemporary(std::string const& _name);
+	/// Records that the encoding uses a symbol with a value that is not
+	/// reproduced by a replay.
+	void recordUnreplayable();
+	//@}
+
 private:
+	/// Active recordings, innermost last. Declared first, since symbolic
+	/// variables report to them until they are destroyed.
+	std::vector<Recording> m_recordings;
+
 	/// Symbolic expressions.
 	//{@
 	/// Symbolic variables.
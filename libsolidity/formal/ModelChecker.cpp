@@ -28,11 +28,35 @@ ModelChecker::ModelChecker(
 	ErrorReporter& _errorReporter,
 	map<h256, string> const& _smtlib2Responses,
 	ReadCallback::Callback const& _smtCallback,
-	smtutil::SMTSolverChoice _enabledSolvers
+	smtutil::SMTSolverChoice _enabledSolvers,
+	smtutil::SMTPortfolioMode _portfolioMode,
+	string const& _queryCacheDirectory,
+	unsigned _chcWorkers
 ):
 	m_context(),
-	m_bmc(m_context, _errorReporter, _smtlib2Responses, _smtCallback, _enabledSolvers),
-	m_chc(m_context, _errorReporter, _smtlib2Responses, _smtCallback, _enabledSolvers)
+	m_queryCache(
+		_queryCacheDirectory.empty() ?
+		nullptr :
+		make_unique<smtutil::SMTQueryCache>(_queryCacheDirectory)
+	),
+	m_bmc(
+		m_context,
+		_errorReporter,
+		_smtlib2Responses,
+		_smtCallback,
+		_enabledSolvers,
+		_portfolioMode,
+		m_queryCache.get()
+	),
+	m_chc(
+		m_context,
+		_errorReporter,
+		_smtlib2Responses,
+		_smtCallback,
+		_enabledSolvers,
+		m_queryCache.get(),
+		_chcWorkers
+	)
 {
 }
 
@@ -29,6 +29,7 @@
 
 #include <libsolidity/interface/ReadFile.h>
 
+#include <libsmtutil/SMTQueryCache.h>
 #include <libsmtutil/SolverInterface.h>
 #include <liblangutil/ErrorReporter.h>
 
@@ -46,11 +47,19 @@ class ModelChecker
 public:
 	/// @param _enabledSolvers represents a runtime choice of which SMT solvers
 	/// should be used, even if all are available. The default choice is to use all.
+	/// @param _portfolioMode determines whether the BMC queries are sent to the
+	/// enabled solvers one after the other or concurrently.
+	/// @param _queryCacheDirectory if not empty, the results of the queries answered
+	/// by the solvers linked into this binary are cached persistently in this directory.
+	/// @param _chcWorkers is the number of threads on which the CHC queries are answered.
 	ModelChecker(
 		langutil::ErrorReporter& _errorReporter,
 		std::map<solidity::util::h256, std::string> const& _smtlib2Responses,
 		ReadCallback::Callback const& _smtCallback = ReadCallback::Callback(),
-		smtutil::SMTSolverChoice _enabledSolvers = smtutil::SMTSolverChoice::All()
+		smtutil::SMTSolverChoice _enabledSolvers = smtutil::SMTSolverChoice::All(),
+		smtutil::SMTPortfolioMode _portfolioMode = smtutil::SMTPortfolioMode::Sequential,
+		std::string const& _queryCacheDirectory = "",
+		unsigned _chcWorkers = 1
 	);
 
 	void analyze(SourceUnit const& _sources);
@@ -67,6 +76,9 @@ private:
 	/// Stores the context of the encoding.
 	smt::EncodingContext m_context;
 
+	/// Persistent cache of query results shared by the engines, if enabled.
+	std::unique_ptr<smtutil::SMTQueryCache> m_queryCache;
+
 	/// Bounded Model Checker engine.
 	BMC m_bmc;
 
@@ -2210,7 +2210,10 @@ set<VariableDeclaration const*> SMTEncoder::touchedVariables(ASTNode const& _nod
 	vector<CallableDeclaration const*> callStack;
 	for (auto const& call: m_callStack)
 		callStack.push_back(call.first);
-	return m_variableUsage.touchedVariables(_node, callStack);
+	auto touched = m_variableUsage.touchedVariables(_node, callStack);
+	for (auto const* function: m_variableUsage.queriedFunctions())
+		recordCallStackQuery(*function);
+	return touched;
 }
 
 VariableDeclaration const* SMTEncoder::identifierToVariable(Expression const& _expr)
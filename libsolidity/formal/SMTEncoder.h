@@ -313,6 +313,8 @@ protected:
 	bool isRootFunction();
 	/// Returns true if _funDef was already visited.
 	bool visitedFunction(FunctionDefinition const* _funDef);
+	/// Called when the encoding depends on whether @a _funDef is in the callstack.
+	virtual void recordCallStackQuery(FunctionDefinition const&) {}
 
 	/// Depth of visit to modifiers.
 	/// When m_modifierDepth == #modifiers the function can be visited
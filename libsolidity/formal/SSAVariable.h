@@ -38,6 +38,8 @@ public:
 	/// This function returns the current index of this SSA variable.
 	unsigned index() const { return m_currentIndex; }
 	unsigned& index() { return m_currentIndex; }
+	/// @returns the index that the next increase allocates.
+	unsigned nextFreeIndex() const { return m_nextFreeIndex; }
 
 	unsigned operator++()
 	{
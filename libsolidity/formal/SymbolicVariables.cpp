@@ -46,6 +46,7 @@ SymbolicVariable::SymbolicVariable(
 	solAssert(m_type, "");
 	m_sort = smtSort(*m_type);
 	solAssert(m_sort, "");
+	m_context.recordCreation(*this);
 }
 
 SymbolicVariable::SymbolicVariable(
@@ -59,6 +60,13 @@ SymbolicVariable::SymbolicVariable(
 	m_ssa(make_unique<SSAVariable>())
 {
 	solAssert(m_sort, "");
+	m_context.recordCreation(*this);
+}
+
+SymbolicVariable::~SymbolicVariable()
+{
+	if (m_recorded)
+		m_context.recordDestruction(*this);
 }
 
 smtutil::Expression SymbolicVariable::currentValue(frontend::TypePointer const&) const
@@ -83,27 +91,39 @@ string SymbolicVariable::nameAtIndex(unsigned _index) const
 
 string SymbolicVariable::uniqueSymbol(unsigned _index) const
 {
+	m_context.recordUse(*this);
 	return m_uniqueName + "_" + to_string(_index);
 }
 
 smtutil::Expression SymbolicVariable::resetIndex()
 {
+	m_context.recordIndexReset(*this);
 	m_ssa->resetIndex();
 	return currentValue();
 }
 
 smtutil::Expression SymbolicVariable::setIndex(unsigned _index)
 {
+	m_context.recordChange(*this);
 	m_ssa->setIndex(_index);
 	return currentValue();
 }
 
 smtutil::Expression SymbolicVariable::increaseIndex()
 {
+	m_context.recordChange(*this);
 	++(*m_ssa);
 	return currentValue();
 }
 
+void SymbolicVariable::setIndices(unsigned _index, unsigned _nextFreeIndex)
+{
+	solAssert(_index < _nextFreeIndex, "");
+	m_context.recordChange(*this);
+	m_ssa->setIndex(_nextFreeIndex - 1);
+	m_ssa->setIndex(_index);
+}
+
 SymbolicBoolVariable::SymbolicBoolVariable(
 	frontend::TypePointer _type,
 	string _uniqueName,
@@ -172,6 +192,7 @@ smtutil::Expression SymbolicFunctionVariable::currentValue(frontend::TypePointer
 
 smtutil::Expression SymbolicFunctionVariable::currentFunctionValue() const
 {
+	m_context.recordUse(*this);
 	return m_declaration;
 }
 
@@ -193,20 +214,30 @@ smtutil::Expression SymbolicFunctionVariable::resetIndex()
 
 smtutil::Expression SymbolicFunctionVariable::setIndex(unsigned _index)
 {
+	// The declaration is not updated here, which a replayed encoding could not reproduce.
+	m_context.recordIndexReset(*this);
 	SymbolicVariable::setIndex(_index);
 	return m_abstract.setIndex(_index);
 }
 
 smtutil::Expression SymbolicFunctionVariable::increaseIndex()
 {
+	m_context.recordChange(*this);
 	++(*m_ssa);
 	resetDeclaration();
 	m_abstract.increaseIndex();
 	return m_abstract.currentValue();
 }
 
+void SymbolicFunctionVariable::setIndices(unsigned _index, unsigned _nextFreeIndex)
+{
+	SymbolicVariable::setIndices(_index, _nextFreeIndex);
+	resetDeclaration();
+}
+
 smtutil::Expression SymbolicFunctionVariable::operator()(vector<smtutil::Expression> _arguments) const
 {
+	m_context.recordUse(*this);
 	return m_declaration(_arguments);
 }
 
@@ -53,7 +53,7 @@ public:
 
 	SymbolicVariable(SymbolicVariable&&) = default;
 
-	virtual ~SymbolicVariable() = default;
+	virtual ~SymbolicVariable();
 
 	virtual smtutil::Expression currentValue(frontend::TypePointer const& _targetType = TypePointer{}) const;
 	std::string currentName() const;
@@ -69,6 +69,12 @@ public:
 
 	unsigned index() const { return m_ssa->index(); }
 	unsigned& index() { return m_ssa->index(); }
+	unsigned nextFreeIndex() const { return m_ssa->nextFreeIndex(); }
+	/// Sets the current index to @a _index and makes sure that the indices below
+	/// @a _nextFreeIndex are not allocated again. Unlike setIndex, this does not
+	/// affect the variables this one is composed of.
+	/// Used to replay a recorded encoding, see EncodingContext::startRecording.
+	virtual void setIndices(unsigned _index, unsigned _nextFreeIndex);
 
 	smtutil::SortPointer const& sort() const { return m_sort; }
 	frontend::TypePointer const& type() const { return m_type; }
@@ -86,6 +92,11 @@ protected:
 	std::string m_uniqueName;
 	EncodingContext& m_context;
 	std::unique_ptr<SSAVariable> m_ssa;
+
+private:
+	friend class EncodingContext;
+	/// Whether the context recorded this variable and has to be told about its destruction.
+	mutable bool m_recorded = false;
 };
 
 /**
@@ -176,6 +187,7 @@ public:
 	smtutil::Expression resetIndex() override;
 	smtutil::Expression setIndex(unsigned _index) override;
 	smtutil::Expression increaseIndex() override;
+	void setIndices(unsigned _index, unsigned _nextFreeIndex) override;
 
 	smtutil::Expression operator()(std::vector<smtutil::Expression> _arguments) const override;
 
@@ -32,6 +32,7 @@ using namespace solidity::frontend::smt;
 set<VariableDeclaration const*> VariableUsage::touchedVariables(ASTNode const& _node, vector<CallableDeclaration const*> const& _outerCallstack)
 {
 	m_touchedVariables.clear();
+	m_queriedFunctions.clear();
 	m_callStack.clear();
 	m_callStack += _outerCallstack;
 	if (!m_callStack.empty())
@@ -64,6 +65,7 @@ void VariableUsage::endVisit(FunctionCall const& _funCall)
 		if (auto funDef = SMTEncoder::functionCallToDefinition(_funCall))
 		{
 			solAssert(funDef, "");
+			m_queriedFunctions.insert(funDef);
 			if (find(m_callStack.begin(), m_callStack.end(), funDef) == m_callStack.end())
 				funDef->accept(*this);
 		}
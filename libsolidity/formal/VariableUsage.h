@@ -38,6 +38,10 @@ public:
 	/// Sets whether to inline function calls.
 	void setFunctionInlining(std::function<bool(FunctionCall const&)> _inlineFunctionCalls) { m_inlineFunctionCalls = _inlineFunctionCalls; }
 
+	/// @returns the inlined functions that were looked up in the callstack
+	/// by the last call to touchedVariables.
+	std::set<FunctionDefinition const*> const& queriedFunctions() const { return m_queriedFunctions; }
+
 private:
 	void endVisit(Identifier const& _node) override;
 	void endVisit(IndexAccess const& _node) override;
@@ -51,6 +55,7 @@ private:
 	void checkIdentifier(Identifier const& _identifier);
 
 	std::set<VariableDeclaration const*> m_touchedVariables;
+	std::set<FunctionDefinition const*> m_queriedFunctions;
 	std::vector<CallableDeclaration const*> m_callStack;
 	CallableDeclaration const* m_lastCall = nullptr;
 
@@ -45,6 +45,7 @@
 #include <libsolidity/ast/TypeProvider.h>
 #include <libsolidity/ast/ASTJsonImporter.h>
 #include <libsolidity/codegen/Compiler.h>
+#include <libsolidity/codegen/MultiUseYulFunctionCollector.h>
 #include <libsolidity/formal/ModelChecker.h>
 #include <libsolidity/interface/ABI.h>
 #include <libsolidity/interface/Natspec.h>
@@ -145,6 +146,27 @@ void CompilerStack::setSMTSolverChoice(smtutil::SMTSolverChoice _enabledSMTSolve
 	m_enabledSMTSolvers = _enabledSMTSolvers;
 }
 
+void CompilerStack::setSMTPortfolioMode(smtutil::SMTPortfolioMode _portfolioMode)
+{
+	if (m_stackState >= ParsedAndImported)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set SMT portfolio mode before parsing."));
+	m_smtPortfolioMode = _portfolioMode;
+}
+
+void CompilerStack::setSMTQueryCacheDirectory(string _directory)
+{
+	if (m_stackState >= ParsedAndImported)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set SMT query cache directory before parsing."));
+	m_smtQueryCacheDirectory = move(_directory);
+}
+
+void CompilerStack::setSMTCHCWorkers(unsigned _workers)
+{
+	if (m_stackState >= ParsedAndImported)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set number of CHC workers before parsing."));
+	m_smtCHCWorkers = _workers;
+}
+
 void CompilerStack::setLibraries(std::map<std::string, util::h160> const& _libraries)
 {
 	if (m_stackState >= ParsedAndImported)
@@ -208,7 +230,11 @@ void CompilerStack::reset(bool _keepSettings)
 		m_libraries.clear();
 		m_evmVersion = langutil::EVMVersion();
 		m_enabledSMTSolvers = smtutil::SMTSolverChoice::All();
+		m_smtPortfolioMode = smtutil::SMTPortfolioMode::Sequential;
+		m_smtQueryCacheDirectory.clear();
+		m_smtCHCWorkers = 1;
 		m_generateIR = false;
+		m_printIROptimized = true;
 		m_generateEwasm = false;
 		m_revertStrings = RevertStrings::Default;
 		m_optimiserSettings = OptimiserSettings::minimal();
@@ -219,6 +245,7 @@ void CompilerStack::reset(bool _keepSettings)
 	m_globalContext.reset();
 	m_sourceOrder.clear();
 	m_contracts.clear();
+	m_yulFunctionCache.reset();
 	m_errorReporter.clear();
 	TypeProvider::reset();
 }
@@ -443,7 +470,15 @@ bool CompilerStack::analyze()
 
 		if (noErrors)
 		{
-			ModelChecker modelChecker(m_errorReporter, m_smtlib2Responses, m_readFile, m_enabledSMTSolvers);
+			ModelChecker modelChecker(
+				m_errorReporter,
+				m_smtlib2Responses,
+				m_readFile,
+				m_enabledSMTSolvers,
+				m_smtPortfolioMode,
+				m_smtQueryCacheDirectory,
+				m_smtCHCWorkers
+			);
 			for (Source const* source: m_sourceOrder)
 				if (source->ast)
 					modelChecker.analyze(*source->ast);
@@ -514,6 +549,8 @@ bool CompilerStack::compile(State _stopAfter)
 	if (m_hasError)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Called compile with errors."));
 
+	m_yulFunctionCache = make_shared<MultiUseYulFunctionCache>();
+
 	// Only compile contracts individually which have been requested.
 	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
 	for (Source const* source: m_sourceOrder)
@@ -1158,7 +1195,12 @@ void CompilerStack::compileContract(
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
 
-	shared_ptr<Compiler> compiler = make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings);
+	shared_ptr<Compiler> compiler = make_shared<Compiler>(
+		m_evmVersion,
+		m_revertStrings,
+		m_optimiserSettings,
+		m_yulFunctionCache
+	);
 	compiledContract.compiler = compiler;
 
 	bytes cborEncodedMetadata = createCBORMetadata(compiledContract);
@@ -1234,8 +1276,11 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 		otherYulSources.emplace(dependency, m_contracts.at(dependency->fullyQualifiedName()).yulIR);
 	}
 
-	IRGenerator generator(m_evmVersion, m_revertStrings, m_optimiserSettings);
-	tie(compiledContract.yulIR, compiledContract.yulIROptimized) = generator.run(_contract, otherYulSources);
+	IRGenerator generator(m_evmVersion, m_revertStrings, m_optimiserSettings, m_yulFunctionCache);
+	shared_ptr<yul::Object> optimizedObject;
+	tie(compiledContract.yulIR, optimizedObject) = generator.run(_contract, otherYulSources);
+	if (m_printIROptimized || m_generateEwasm)
+		compiledContract.yulIROptimized = IRGenerator::printOptimized(*optimizedObject, m_evmVersion);
 }
 
 void CompilerStack::generateEwasm(ContractDefinition const& _contract)
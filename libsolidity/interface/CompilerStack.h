@@ -73,6 +73,7 @@ class ContractDefinition;
 class FunctionDefinition;
 class SourceUnit;
 class Compiler;
+class MultiUseYulFunctionCache;
 class GlobalContext;
 class Natspec;
 class DeclarationContainer;
@@ -168,6 +169,16 @@ public:
 	/// Set which SMT solvers should be enabled.
 	void setSMTSolverChoice(smtutil::SMTSolverChoice _enabledSolvers);
 
+	/// Set whether the enabled SMT solvers are queried sequentially or concurrently.
+	void setSMTPortfolioMode(smtutil::SMTPortfolioMode _portfolioMode);
+
+	/// Set the directory in which the results of SMT queries are cached between runs.
+	/// The cache is disabled if @a _directory is empty.
+	void setSMTQueryCacheDirectory(std::string _directory);
+
+	/// Set the number of threads on which the CHC engine answers its queries.
+	void setSMTCHCWorkers(unsigned _workers);
+
 	/// Sets the requested contract names by source.
 	/// If empty, no filtering is performed and every contract
 	/// found in the supplied sources is compiled.
@@ -181,7 +192,12 @@ public:
 	void enableEvmBytecodeGeneration(bool _enable = true) { m_generateEvmBytecode = _enable; }
 
 	/// Enable experimental generation of Yul IR code.
-	void enableIRGeneration(bool _enable = true) { m_generateIR = _enable; }
+	/// The optimized IR is only printed if @a _printOptimized is true or Ewasm generation is enabled.
+	void enableIRGeneration(bool _enable = true, bool _printOptimized = true)
+	{
+		m_generateIR = _enable;
+		m_printIROptimized = _printOptimized;
+	}
 
 	/// Enable experimental generation of Ewasm code. If enabled, IR is also generated.
 	void enableEwasmGeneration(bool _enable = true) { m_generateEwasm = _enable; }
@@ -353,7 +369,7 @@ private:
 		evmasm::LinkerObject object; ///< Deployment object (includes the runtime sub-object).
 		evmasm::LinkerObject runtimeObject; ///< Runtime object.
 		std::string yulIR; ///< Experimental Yul IR code.
-		std::string yulIROptimized; ///< Optimized experimental Yul IR code.
+		std::string yulIROptimized; ///< Optimized experimental Yul IR code, if requested.
 		std::string ewasm; ///< Experimental Ewasm text representation
 		evmasm::LinkerObject ewasmObject; ///< Experimental Ewasm code
 		util::LazyInit<std::string const> metadata; ///< The metadata json that will be hashed into the chain.
@@ -453,9 +469,13 @@ private:
 	State m_stopAfter = State::CompilationSuccessful;
 	langutil::EVMVersion m_evmVersion;
 	smtutil::SMTSolverChoice m_enabledSMTSolvers;
+	smtutil::SMTPortfolioMode m_smtPortfolioMode = smtutil::SMTPortfolioMode::Sequential;
+	std::string m_smtQueryCacheDirectory;
+	unsigned m_smtCHCWorkers = 1;
 	std::map<std::string, std::set<std::string>> m_requestedContractNames;
 	bool m_generateEvmBytecode = true;
 	bool m_generateIR = false;
+	bool m_printIROptimized = true;
 	bool m_generateEwasm = false;
 	std::map<std::string, util::h160> m_libraries;
 	/// list of path prefix remappings, e.g. mylibrary: github.com/ethereum = /usr/local/ethereum
@@ -469,6 +489,8 @@ private:
 	std::shared_ptr<GlobalContext> m_globalContext;
 	std::vector<Source const*> m_sourceOrder;
 	std::map<std::string const, Contract> m_contracts;
+	/// Yul utility functions shared between the code generators of all contracts.
+	std::shared_ptr<MultiUseYulFunctionCache> m_yulFunctionCache;
 	langutil::ErrorList m_errorList;
 	langutil::ErrorReporter m_errorReporter;
 	bool m_metadataLiteralSources = false;
@@ -79,6 +79,49 @@ Json::Value formatFatalError(string const& _type, string const& _message)
 	return output;
 }
 
+/// Sets the member at @a _path inside @a _object to @a _value, creating the objects along the path.
+void setMember(Json::Value& _object, vector<string> const& _path, Json::Value _value)
+{
+	Json::Value* member = &_object;
+	for (string const& key: _path)
+		member = &(*member)[key];
+	*member = move(_value);
+}
+
+/// Passes the members of the output object @a _output to @a _sink.
+void emitMembers(Json::Value const& _output, StandardCompiler::OutputSink const& _sink)
+{
+	// Member names are sorted, like the members of objects produced by jsoncpp.
+	for (string const& name: _output.getMemberNames())
+		_sink({name}, _output[name]);
+}
+
+/// @returns the output for the exception that is currently being handled.
+/// To be called from within a catch block.
+Json::Value formatUncaughtException()
+{
+	try
+	{
+		throw;
+	}
+	catch (Json::LogicError const& _exception)
+	{
+		return formatFatalError("InternalCompilerError", string("JSON logic exception: ") + _exception.what());
+	}
+	catch (Json::RuntimeError const& _exception)
+	{
+		return formatFatalError("InternalCompilerError", string("JSON runtime exception: ") + _exception.what());
+	}
+	catch (util::Exception const& _exception)
+	{
+		return formatFatalError("InternalCompilerError", "Internal exception in StandardCompiler::compile: " + boost::diagnostic_information(_exception));
+	}
+	catch (...)
+	{
+		return formatFatalError("InternalCompilerError", "Internal exception in StandardCompiler::compile");
+	}
+}
+
 Json::Value formatSourceLocation(SourceLocation const* location)
 {
 	Json::Value sourceLocation;
@@ -316,6 +359,21 @@ bool isIRRequested(Json::Value const& _outputSelection)
 	return false;
 }
 
+/// @returns true if the optimized Yul IR was requested.
+bool isIROptimizedRequested(Json::Value const& _outputSelection)
+{
+	if (!_outputSelection.isObject())
+		return false;
+
+	for (auto const& fileRequests: _outputSelection)
+		for (auto const& requests: fileRequests)
+			for (auto const& request: requests)
+				if (request == "irOptimized")
+					return true;
+
+	return false;
+}
+
 Json::Value formatLinkReferences(std::map<size_t, std::string> const& linkReferences)
 {
 	Json::Value ret(Json::objectValue);
@@ -869,7 +927,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 	return { std::move(ret) };
 }
 
-Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inputsAndSettings)
+void StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inputsAndSettings, OutputSink const& _output)
 {
 	CompilerStack compilerStack(m_readFile);
 
@@ -888,7 +946,10 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	compilerStack.setRequestedContractNames(requestedContractNames(_inputsAndSettings.outputSelection));
 
 	compilerStack.enableEvmBytecodeGeneration(isEvmBytecodeRequested(_inputsAndSettings.outputSelection));
-	compilerStack.enableIRGeneration(isIRRequested(_inputsAndSettings.outputSelection));
+	compilerStack.enableIRGeneration(
+		isIRRequested(_inputsAndSettings.outputSelection),
+		isIROptimizedRequested(_inputsAndSettings.outputSelection)
+	);
 	compilerStack.enableEwasmGeneration(isEwasmRequested(_inputsAndSettings.outputSelection));
 
 	Json::Value errors = std::move(_inputsAndSettings.errors);
@@ -1026,40 +1087,33 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 		((binariesRequested && !compilationSuccess) || !analysisPerformed) &&
 		(errors.empty() && _inputsAndSettings.stopAfter >= CompilerStack::State::AnalysisPerformed)
 	)
-		return formatFatalError("InternalCompilerError", "No error reported, but compilation failed.");
-
-	Json::Value output = Json::objectValue;
-
-	if (errors.size() > 0)
-		output["errors"] = std::move(errors);
+		return emitMembers(formatFatalError("InternalCompilerError", "No error reported, but compilation failed."), _output);
 
+	// The members of the output are produced in the order of their keys, so that they can
+	// be written out and released right away, see util::JsonObjectStreamWriter.
 	if (!compilerStack.unhandledSMTLib2Queries().empty())
+	{
+		Json::Value queries = Json::objectValue;
 		for (string const& query: compilerStack.unhandledSMTLib2Queries())
-			output["auxiliaryInputRequested"]["smtlib2queries"]["0x" + util::keccak256(query).hex()] = query;
+			queries["0x" + util::keccak256(query).hex()] = query;
+		_output({"auxiliaryInputRequested", "smtlib2queries"}, std::move(queries));
+	}
 
 	bool const wildcardMatchesExperimental = false;
 
-	output["sources"] = Json::objectValue;
-	unsigned sourceIndex = 0;
-	if (compilerStack.state() >= CompilerStack::State::Parsed && (!compilerStack.hasError() || _inputsAndSettings.parserErrorRecovery))
-		for (string const& sourceName: compilerStack.sourceNames())
-		{
-			Json::Value sourceResult = Json::objectValue;
-			sourceResult["id"] = sourceIndex++;
-			if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "ast", wildcardMatchesExperimental))
-				sourceResult["ast"] = ASTJsonConverter(false, compilerStack.state(), compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
-			if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "legacyAST", wildcardMatchesExperimental))
-				sourceResult["legacyAST"] = ASTJsonConverter(true, compilerStack.state(), compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
-			output["sources"][sourceName] = sourceResult;
-		}
-
-	Json::Value contractsOutput = Json::objectValue;
+	// Contract names are "<file>:<name>", which are not sorted by file and name in general.
+	vector<pair<string, string>> fileAndContractNames;
 	for (string const& contractName: analysisPerformed ? compilerStack.contractNames() : vector<string>())
 	{
 		size_t colon = contractName.rfind(':');
 		solAssert(colon != string::npos, "");
-		string file = contractName.substr(0, colon);
-		string name = contractName.substr(colon + 1);
+		fileAndContractNames.emplace_back(contractName.substr(0, colon), contractName.substr(colon + 1));
+	}
+	sort(fileAndContractNames.begin(), fileAndContractNames.end());
+
+	for (auto const& [file, name]: fileAndContractNames)
+	{
+		string const contractName = file + ":" + name;
 
 		// ABI, storage layout, documentation and metadata
 		Json::Value contractData(Json::objectValue);
@@ -1129,16 +1183,32 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 			contractData["evm"] = evmData;
 
 		if (!contractData.empty())
-		{
-			if (!contractsOutput.isMember(file))
-				contractsOutput[file] = Json::objectValue;
-			contractsOutput[file][name] = contractData;
-		}
+			_output({"contracts", file, name}, std::move(contractData));
 	}
-	if (!contractsOutput.empty())
-		output["contracts"] = contractsOutput;
 
-	return output;
+	if (errors.size() > 0)
+		_output({"errors"}, std::move(errors));
+
+	vector<string> sourceNames;
+	if (compilerStack.state() >= CompilerStack::State::Parsed && (!compilerStack.hasError() || _inputsAndSettings.parserErrorRecovery))
+		sourceNames = compilerStack.sourceNames();
+	if (sourceNames.empty())
+		_output({"sources"}, Json::objectValue);
+	unsigned sourceIndex = 0;
+	for (string const& sourceName: sourceNames)
+	{
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "ast", wildcardMatchesExperimental))
+			_output(
+				{"sources", sourceName, "ast"},
+				ASTJsonConverter(false, compilerStack.state(), compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName))
+			);
+		_output({"sources", sourceName, "id"}, sourceIndex++);
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "legacyAST", wildcardMatchesExperimental))
+			_output(
+				{"sources", sourceName, "legacyAST"},
+				ASTJsonConverter(true, compilerStack.state(), compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName))
+			);
+	}
 }
 
 
@@ -1228,38 +1298,35 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 }
 
 
-Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
+void StandardCompiler::compile(Json::Value const& _input, OutputSink const& _output)
 {
 	YulStringRepository::reset();
 
+	auto parsed = parseInput(_input);
+	if (std::holds_alternative<Json::Value>(parsed))
+		return emitMembers(std::get<Json::Value>(parsed), _output);
+	InputsAndSettings settings = std::get<InputsAndSettings>(std::move(parsed));
+	if (settings.language == "Solidity")
+		compileSolidity(std::move(settings), _output);
+	else if (settings.language == "Yul")
+		emitMembers(compileYul(std::move(settings)), _output);
+	else
+		emitMembers(formatFatalError("JSONError", "Only \"Solidity\" or \"Yul\" is supported as a language."), _output);
+}
+
+Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
+{
 	try
 	{
-		auto parsed = parseInput(_input);
-		if (std::holds_alternative<Json::Value>(parsed))
-			return std::get<Json::Value>(std::move(parsed));
-		InputsAndSettings settings = std::get<InputsAndSettings>(std::move(parsed));
-		if (settings.language == "Solidity")
-			return compileSolidity(std::move(settings));
-		else if (settings.language == "Yul")
-			return compileYul(std::move(settings));
-		else
-			return formatFatalError("JSONError", "Only \"Solidity\" or \"Yul\" is supported as a language.");
-	}
-	catch (Json::LogicError const& _exception)
-	{
-		return formatFatalError("InternalCompilerError", string("JSON logic exception: ") + _exception.what());
-	}
-	catch (Json::RuntimeError const& _exception)
-	{
-		return formatFatalError("InternalCompilerError", string("JSON runtime exception: ") + _exception.what());
-	}
-	catch (util::Exception const& _exception)
-	{
-		return formatFatalError("InternalCompilerError", "Internal exception in StandardCompiler::compile: " + boost::diagnostic_information(_exception));
+		Json::Value output = Json::objectValue;
+		compile(_input, [&](vector<string> const& _path, Json::Value _value) {
+			setMember(output, _path, std::move(_value));
+		});
+		return output;
 	}
 	catch (...)
 	{
-		return formatFatalError("InternalCompilerError", "Internal exception in StandardCompiler::compile");
+		return formatUncaughtException();
 	}
 }
 
@@ -1290,3 +1357,43 @@ string StandardCompiler::compile(string const& _input) noexcept
 		return "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error writing output JSON.\"}]}";
 	}
 }
+
+void StandardCompiler::compile(string const& _input, ostream& _output) noexcept
+{
+	Json::Value input;
+	string errors;
+	try
+	{
+		if (!util::jsonParseStrict(_input, input, &errors))
+		{
+			_output << util::jsonCompactPrint(formatFatalError("JSONError", errors));
+			return;
+		}
+	}
+	catch (...)
+	{
+		_output << "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error parsing input JSON.\"}]}";
+		return;
+	}
+
+	try
+	{
+		// The output is only written once it is complete, so that an internal error does not
+		// leave a truncated object behind, but is reported like by the other overloads.
+		util::writeJsonObject(_output, [&](util::JsonObjectStreamWriter& _writer) {
+			compile(input, [&](vector<string> const& _path, Json::Value _value) {
+				_writer.add(_path, _value);
+			});
+		});
+	}
+	catch (...)
+	{
+		try
+		{
+			_output << util::jsonCompactPrint(formatUncaughtException());
+		}
+		catch (...)
+		{
+		}
+	}
+}
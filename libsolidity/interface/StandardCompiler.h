@@ -25,9 +25,13 @@
 
 #include <libsolidity/interface/CompilerStack.h>
 
+#include <functional>
 #include <optional>
+#include <ostream>
+#include <string>
 #include <utility>
 #include <variant>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -53,6 +57,15 @@ public:
 	/// Parses input as JSON and peforms the above processing steps, returning a serialized JSON
 	/// output. Parsing errors are returned as regular errors.
 	std::string compile(std::string const& _input) noexcept;
+	/// Parses input as JSON and peforms the above processing steps, writing the serialized JSON
+	/// output to @a _output. The output is identical to the one returned by the above function,
+	/// but the per-source and per-contract parts of the output are serialized and released as
+	/// soon as they are produced. Nothing is written to @a _output before the output is complete.
+	void compile(std::string const& _input, std::ostream& _output) noexcept;
+
+	/// Receives the members of the output object, identified by the path of keys leading
+	/// to them, in the order of their keys.
+	using OutputSink = std::function<void(std::vector<std::string> const& _path, Json::Value _value)>;
 
 private:
 	struct InputsAndSettings
@@ -77,7 +90,11 @@ private:
 	/// it in condensed form or an error as a json object.
 	std::variant<InputsAndSettings, Json::Value> parseInput(Json::Value const& _input);
 
-	Json::Value compileSolidity(InputsAndSettings _inputsAndSettings);
+	/// Processes @a _input and passes the members of the output to @a _output.
+	/// Exceptions that occur outside of the compilation itself are not caught.
+	void compile(Json::Value const& _input, OutputSink const& _output);
+
+	void compileSolidity(InputsAndSettings _inputsAndSettings, OutputSink const& _output);
 	Json::Value compileYul(InputsAndSettings _inputsAndSettings);
 
 	ReadCallback::Callback m_readFile;
@@ -65,7 +65,15 @@ public:
 		solAssert(m_location.source, "");
 		if (m_location.end < 0)
 			markEndPosition();
-		return make_shared<NodeType>(m_parser.nextID(), m_location, std::forward<Args>(_args)...);
+		solAssert(m_parser.m_arena, "");
+		auto node = allocate_shared<NodeType>(
+			ASTArenaAllocator<NodeType>(m_parser.m_arena),
+			m_parser.nextID(),
+			m_location,
+			std::forward<Args>(_args)...
+		);
+		node->setArena(m_parser.m_arena.get());
+		return node;
 	}
 
 	SourceLocation const& location() const noexcept { return m_location; }
@@ -82,6 +90,7 @@ ASTPointer<SourceUnit> Parser::parse(shared_ptr<Scanner> const& _scanner)
 	{
 		m_recursionDepth = 0;
 		m_scanner = _scanner;
+		m_arena = make_shared<ASTArena>();
 		ASTNodeFactory nodeFactory(*this);
 
 		vector<ASTPointer<ASTNode>> nodes;
@@ -216,8 +225,8 @@ ASTPointer<ImportDirective> Parser::parseImportDirective()
 	// import {a as b, c} from "abc";
 	ASTNodeFactory nodeFactory(*this);
 	expectToken(Token::Import);
-	ASTPointer<ASTString> path;
-	ASTPointer<ASTString> unitAlias = make_shared<string>();
+	ASTPointer<ASTString const> path;
+	ASTPointer<ASTString const> unitAlias = make_shared<string>();
 	ImportDirective::SymbolAliasList symbolAliases;
 
 	if (m_scanner->currentToken() == Token::StringLiteral)
@@ -236,7 +245,7 @@ ASTPointer<ImportDirective> Parser::parseImportDirective()
 			m_scanner->next();
 			while (true)
 			{
-				ASTPointer<ASTString> alias;
+				ASTPointer<ASTString const> alias;
 				SourceLocation aliasLocation = currentLocation();
 				ASTPointer<Identifier> id = parseIdentifier();
 				if (m_scanner->currentToken() == Token::As)
@@ -308,7 +317,7 @@ ASTPointer<ContractDefinition> Parser::parseContractDefinition()
 {
 	RecursionGuard recursionGuard(*this);
 	ASTNodeFactory nodeFactory(*this);
-	ASTPointer<ASTString> name =  nullptr;
+	ASTPointer<ASTString const> name =  nullptr;
 	ASTPointer<StructuredDocumentation> documentation;
 	vector<ASTPointer<InheritanceSpecifier>> baseContracts;
 	vector<ASTPointer<ASTNode>> subNodes;
@@ -563,7 +572,7 @@ ASTPointer<ASTNode> Parser::parseFunctionDefinition(bool _freeFunction)
 	ASTPointer<StructuredDocumentation> documentation = parseStructuredDocumentation();
 
 	Token kind = m_scanner->currentToken();
-	ASTPointer<ASTString> name;
+	ASTPointer<ASTString const> name;
 	if (kind == Token::Function)
 	{
 		m_scanner->next();
@@ -632,7 +641,7 @@ ASTPointer<StructDefinition> Parser::parseStructDefinition()
 	RecursionGuard recursionGuard(*this);
 	ASTNodeFactory nodeFactory(*this);
 	expectToken(Token::Struct);
-	ASTPointer<ASTString> name = expectIdentifierToken();
+	ASTPointer<ASTString const> name = expectIdentifierToken();
 	vector<ASTPointer<VariableDeclaration>> members;
 	expectToken(Token::LBrace);
 	while (m_scanner->currentToken() != Token::RBrace)
@@ -658,7 +667,7 @@ ASTPointer<EnumDefinition> Parser::parseEnumDefinition()
 	RecursionGuard recursionGuard(*this);
 	ASTNodeFactory nodeFactory(*this);
 	expectToken(Token::Enum);
-	ASTPointer<ASTString> name = expectIdentifierToken();
+	ASTPointer<ASTString const> name = expectIdentifierToken();
 	vector<ASTPointer<EnumValue>> members;
 	expectToken(Token::LBrace);
 
@@ -708,7 +717,7 @@ ASTPointer<VariableDeclaration> Parser::parseVariableDeclaration(
 	ASTPointer<OverrideSpecifier> overrides = nullptr;
 	Visibility visibility(Visibility::Default);
 	VariableDeclaration::Location location = VariableDeclaration::Location::Unspecified;
-	ASTPointer<ASTString> identifier;
+	ASTPointer<ASTString const> identifier;
 
 	while (true)
 	{
@@ -822,7 +831,7 @@ ASTPointer<ModifierDefinition> Parser::parseModifierDefinition()
 	ASTPointer<StructuredDocumentation> documentation = parseStructuredDocumentation();
 
 	expectToken(Token::Modifier);
-	ASTPointer<ASTString> name(expectIdentifierToken());
+	ASTPointer<ASTString const> name(expectIdentifierToken());
 	ASTPointer<ParameterList> parameters;
 	if (m_scanner->currentToken() == Token::LParen)
 	{
@@ -877,7 +886,7 @@ ASTPointer<EventDefinition> Parser::parseEventDefinition()
 	ASTPointer<StructuredDocumentation> documentation = parseStructuredDocumentation();
 
 	expectToken(Token::Event);
-	ASTPointer<ASTString> name(expectIdentifierToken());
+	ASTPointer<ASTString const> name(expectIdentifierToken());
 
 	VarDeclParserOptions options;
 	options.allowIndexed = true;
@@ -1088,7 +1097,7 @@ ASTPointer<ParameterList> Parser::parseParameterList(
 	return nodeFactory.createNode<ParameterList>(parameters);
 }
 
-ASTPointer<Block> Parser::parseBlock(ASTPointer<ASTString> const& _docString)
+ASTPointer<Block> Parser::parseBlock(ASTPointer<ASTString const> const& _docString)
 {
 	RecursionGuard recursionGuard(*this);
 	ASTNodeFactory nodeFactory(*this);
@@ -1120,7 +1129,7 @@ ASTPointer<Block> Parser::parseBlock(ASTPointer<ASTString> const& _docString)
 ASTPointer<Statement> Parser::parseStatement()
 {
 	RecursionGuard recursionGuard(*this);
-	ASTPointer<ASTString> docString;
+	ASTPointer<ASTString const> docString;
 	ASTPointer<Statement> statement;
 	try
 	{
@@ -1203,7 +1212,7 @@ ASTPointer<Statement> Parser::parseStatement()
 	return statement;
 }
 
-ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> const& _docString)
+ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString const> const& _docString)
 {
 	RecursionGuard recursionGuard(*this);
 	SourceLocation location = currentLocation();
@@ -1224,10 +1233,12 @@ ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> con
 		BOOST_THROW_EXCEPTION(FatalError());
 
 	location.end = block->location.end;
-	return make_shared<InlineAssembly>(nextID(), location, _docString, dialect, block);
+	ASTNodeFactory nodeFactory(*this);
+	nodeFactory.setLocation(location);
+	return nodeFactory.createNode<InlineAssembly>(_docString, dialect, block);
 }
 
-ASTPointer<IfStatement> Parser::parseIfStatement(ASTPointer<ASTString> const& _docString)
+ASTPointer<IfStatement> Parser::parseIfStatement(ASTPointer<ASTString const> const& _docString)
 {
 	RecursionGuard recursionGuard(*this);
 	ASTNodeFactory nodeFactory(*this);
@@ -1248,7 +1259,7 @@ ASTPointer<IfStatement> Parser::parseIfStatement(ASTPointer<ASTString> const& _d
 	return nodeFactory.createNode<IfStatement>(_docString, condition, trueBody, falseBody);
 }
 
-ASTPointer<TryStatement> Parser::parseTryStatement(ASTPointer<ASTString> const& _docString)
+ASTPointer<TryStatement> Parser::parseTryStatement(ASTPointer<ASTString const> const& _docString)
 {
 	RecursionGuard recursionGuard(*this);
 	ASTNodeFactory nodeFactory(*this);
@@ -1288,7 +1299,7 @@ ASTPointer<TryCatchClause> Parser::parseCatchClause()
 	RecursionGuard recursionGuard(*this);
 	ASTNodeFactory nodeFactory(*this);
 	expectToken(Token::Catch);
-	ASTPointer<ASTString> errorName = make_shared<string>();
+	ASTPointer<ASTString const> errorName = make_shared<string>();
 	ASTPointer<ParameterList> errorParameters;
 	if (m_scanner->currentToken() != Token::LBrace)
 	{
@@ -1304,7 +1315,7 @@ ASTPointer<TryCatchClause> Parser::parseCatchClause()
 	return nodeFactory.createNode<TryCatchClause>(errorName, errorParameters, block);
 }
 
-ASTPointer<WhileStatement> Parser::parseWhileStatement(ASTPointer<ASTString> const& _docString)
+ASTPointer<WhileStatement> Parser::parseWhileStatement(ASTPointer<ASTString const> const& _docString)
 {
 	RecursionGuard recursionGuard(*this);
 	ASTNodeFactory nodeFactory(*this);
@@ -1317,7 +1328,7 @@ ASTPointer<WhileStatement> Parser::parseWhileStatement(ASTPointer<ASTString> con
 	return nodeFactory.createNode<WhileStatement>(_docString, condition, body, false);
 }
 
-ASTPointer<WhileStatement> Parser::parseDoWhileStatement(ASTPointer<ASTString> const& _docString)
+ASTPointer<WhileStatement> Parser::parseDoWhileStatement(ASTPointer<ASTString const> const& _docString)
 {
 	RecursionGuard recursionGuard(*this);
 	ASTNodeFactory nodeFactory(*this);
@@ -1333,7 +1344,7 @@ ASTPointer<WhileStatement> Parser::parseDoWhileStatement(ASTPointer<ASTString> c
 }
 
 
-ASTPointer<ForStatement> Parser::parseForStatement(ASTPointer<ASTString> const& _docString)
+ASTPointer<ForStatement> Parser::parseForStatement(ASTPointer<ASTString const> const& _docString)
 {
 	RecursionGuard recursionGuard(*this);
 	ASTNodeFactory nodeFactory(*this);
@@ -1345,7 +1356,7 @@ ASTPointer<ForStatement> Parser::parseForStatement(ASTPointer<ASTString> const&
 
 	// LTODO: Maybe here have some predicate like peekExpression() instead of checking for semicolon and RParen?
 	if (m_scanner->currentToken() != Token::Semicolon)
-		initExpression = parseSimpleStatement(ASTPointer<ASTString>());
+		initExpression = parseSimpleStatement(ASTPointer<ASTString const>());
 	expectToken(Token::Semicolon);
 
 	if (m_scanner->currentToken() != Token::Semicolon)
@@ -1353,7 +1364,7 @@ ASTPointer<ForStatement> Parser::parseForStatement(ASTPointer<ASTString> const&
 	expectToken(Token::Semicolon);
 
 	if (m_scanner->currentToken() != Token::RParen)
-		loopExpression = parseExpressionStatement(ASTPointer<ASTString>());
+		loopExpression = parseExpressionStatement(ASTPointer<ASTString const>());
 	expectToken(Token::RParen);
 
 	ASTPointer<Statement> body = parseStatement();
@@ -1367,7 +1378,7 @@ ASTPointer<ForStatement> Parser::parseForStatement(ASTPointer<ASTString> const&
 	);
 }
 
-ASTPointer<EmitStatement> Parser::parseEmitStatement(ASTPointer<ASTString> const& _docString)
+ASTPointer<EmitStatement> Parser::parseEmitStatement(ASTPointer<ASTString const> const& _docString)
 {
 	expectToken(Token::Emit, false);
 
@@ -1391,7 +1402,7 @@ ASTPointer<EmitStatement> Parser::parseEmitStatement(ASTPointer<ASTString> const
 	expectToken(Token::LParen);
 
 	vector<ASTPointer<Expression>> arguments;
-	vector<ASTPointer<ASTString>> names;
+	vector<ASTPointer<ASTString const>> names;
 	std::tie(arguments, names) = parseFunctionCallArguments();
 	eventCallNodeFactory.markEndPosition();
 	nodeFactory.markEndPosition();
@@ -1401,7 +1412,7 @@ ASTPointer<EmitStatement> Parser::parseEmitStatement(ASTPointer<ASTString> const
 	return statement;
 }
 
-ASTPointer<Statement> Parser::parseSimpleStatement(ASTPointer<ASTString> const& _docString)
+ASTPointer<Statement> Parser::parseSimpleStatement(ASTPointer<ASTString const> const& _docString)
 {
 	RecursionGuard recursionGuard(*this);
 	LookAheadInfo statementType;
@@ -1525,7 +1536,7 @@ pair<Parser::LookAheadInfo, Parser::IndexAccessedPath> Parser::tryParseIndexAcce
 }
 
 ASTPointer<VariableDeclarationStatement> Parser::parseVariableDeclarationStatement(
-	ASTPointer<ASTString> const& _docString,
+	ASTPointer<ASTString const> const& _docString,
 	ASTPointer<TypeName> const& _lookAheadArrayType
 )
 {
@@ -1554,7 +1565,7 @@ ASTPointer<VariableDeclarationStatement> Parser::parseVariableDeclarationStateme
 }
 
 ASTPointer<ExpressionStatement> Parser::parseExpressionStatement(
-	ASTPointer<ASTString> const& _docString,
+	ASTPointer<ASTString const> const& _docString,
 	ASTPointer<Expression> const& _partialParserResult
 )
 {
@@ -1709,7 +1720,7 @@ ASTPointer<Expression> Parser::parseLeftHandSideExpression(
 			nodeFactory.markEndPosition();
 			if (m_scanner->currentToken() == Token::Address)
 			{
-				expression = nodeFactory.createNode<MemberAccess>(expression, make_shared<ASTString>("address"));
+				expression = nodeFactory.createNode<MemberAccess>(expression, intern("address"));
 				m_scanner->next();
 			}
 			else
@@ -1720,7 +1731,7 @@ ASTPointer<Expression> Parser::parseLeftHandSideExpression(
 		{
 			m_scanner->next();
 			vector<ASTPointer<Expression>> arguments;
-			vector<ASTPointer<ASTString>> names;
+			vector<ASTPointer<ASTString const>> names;
 			std::tie(arguments, names) = parseFunctionCallArguments();
 			nodeFactory.markEndPosition();
 			expectToken(Token::RParen);
@@ -1769,7 +1780,7 @@ ASTPointer<Expression> Parser::parsePrimaryExpression()
 	case Token::Number:
 		if (TokenTraits::isEtherSubdenomination(m_scanner->peekNextToken()))
 		{
-			ASTPointer<ASTString> literal = getLiteralAndAdvance();
+			ASTPointer<ASTString const> literal = getLiteralAndAdvance();
 			nodeFactory.markEndPosition();
 			Literal::SubDenomination subdenomination = static_cast<Literal::SubDenomination>(m_scanner->currentToken());
 			m_scanner->next();
@@ -1777,7 +1788,7 @@ ASTPointer<Expression> Parser::parsePrimaryExpression()
 		}
 		else if (TokenTraits::isTimeSubdenomination(m_scanner->peekNextToken()))
 		{
-			ASTPointer<ASTString> literal = getLiteralAndAdvance();
+			ASTPointer<ASTString const> literal = getLiteralAndAdvance();
 			nodeFactory.markEndPosition();
 			Literal::SubDenomination subdenomination = static_cast<Literal::SubDenomination>(m_scanner->currentToken());
 			m_scanner->next();
@@ -1815,7 +1826,7 @@ ASTPointer<Expression> Parser::parsePrimaryExpression()
 		// Inside expressions "type" is the name of a special, globally-available function.
 		nodeFactory.markEndPosition();
 		m_scanner->next();
-		expression = nodeFactory.createNode<Identifier>(make_shared<ASTString>("type"));
+		expression = nodeFactory.createNode<Identifier>(intern("type"));
 		break;
 	case Token::LParen:
 	case Token::LBrack:
@@ -1887,10 +1898,10 @@ vector<ASTPointer<Expression>> Parser::parseFunctionCallListArguments()
 	return arguments;
 }
 
-pair<vector<ASTPointer<Expression>>, vector<ASTPointer<ASTString>>> Parser::parseFunctionCallArguments()
+pair<vector<ASTPointer<Expression>>, vector<ASTPointer<ASTString const>>> Parser::parseFunctionCallArguments()
 {
 	RecursionGuard recursionGuard(*this);
-	pair<vector<ASTPointer<Expression>>, vector<ASTPointer<ASTString>>> ret;
+	pair<vector<ASTPointer<Expression>>, vector<ASTPointer<ASTString const>>> ret;
 	Token token = m_scanner->currentToken();
 	if (token == Token::LBrace)
 	{
@@ -1904,9 +1915,9 @@ pair<vector<ASTPointer<Expression>>, vector<ASTPointer<ASTString>>> Parser::pars
 	return ret;
 }
 
-pair<vector<ASTPointer<Expression>>, vector<ASTPointer<ASTString>>> Parser::parseNamedArguments()
+pair<vector<ASTPointer<Expression>>, vector<ASTPointer<ASTString const>>> Parser::parseNamedArguments()
 {
-	pair<vector<ASTPointer<Expression>>, vector<ASTPointer<ASTString>>> ret;
+	pair<vector<ASTPointer<Expression>>, vector<ASTPointer<ASTString const>>> ret;
 
 	bool first = true;
 	while (m_scanner->currentToken() != Token::RBrace)
@@ -2153,18 +2164,28 @@ ASTPointer<ParameterList> Parser::createEmptyParameterList()
 	return nodeFactory.createNode<ParameterList>(vector<ASTPointer<VariableDeclaration>>());
 }
 
-ASTPointer<ASTString> Parser::expectIdentifierToken()
+ASTPointer<ASTString const> Parser::expectIdentifierToken()
 {
 	// do not advance on success
 	expectToken(Token::Identifier, false);
 	return getLiteralAndAdvance();
 }
 
-ASTPointer<ASTString> Parser::getLiteralAndAdvance()
+ASTPointer<ASTString const> Parser::getLiteralAndAdvance()
 {
-	ASTPointer<ASTString> identifier = make_shared<ASTString>(m_scanner->currentLiteral());
+	ASTPointer<ASTString const> identifier = intern(m_scanner->currentLiteral());
 	m_scanner->next();
 	return identifier;
 }
 
+ASTPointer<ASTString const> Parser::intern(string const& _literal)
+{
+	auto it = m_internedStrings.find(_literal);
+	if (it != m_internedStrings.end())
+		return it->second;
+	auto interned = make_shared<ASTString const>(_literal);
+	m_internedStrings.emplace(*interned, interned);
+	return interned;
+}
+
 }
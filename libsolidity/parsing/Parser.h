@@ -27,6 +27,9 @@
 #include <liblangutil/ParserBase.h>
 #include <liblangutil/EVMVersion.h>
 
+#include <string_view>
+#include <unordered_map>
+
 namespace solidity::langutil
 {
 class Scanner;
@@ -114,24 +117,24 @@ private:
 		VarDeclParserOptions const& _options = {},
 		bool _allowEmpty = true
 	);
-	ASTPointer<Block> parseBlock(ASTPointer<ASTString> const& _docString = {});
+	ASTPointer<Block> parseBlock(ASTPointer<ASTString const> const& _docString = {});
 	ASTPointer<Statement> parseStatement();
-	ASTPointer<InlineAssembly> parseInlineAssembly(ASTPointer<ASTString> const& _docString = {});
-	ASTPointer<IfStatement> parseIfStatement(ASTPointer<ASTString> const& _docString);
-	ASTPointer<TryStatement> parseTryStatement(ASTPointer<ASTString> const& _docString);
+	ASTPointer<InlineAssembly> parseInlineAssembly(ASTPointer<ASTString const> const& _docString = {});
+	ASTPointer<IfStatement> parseIfStatement(ASTPointer<ASTString const> const& _docString);
+	ASTPointer<TryStatement> parseTryStatement(ASTPointer<ASTString const> const& _docString);
 	ASTPointer<TryCatchClause> parseCatchClause();
-	ASTPointer<WhileStatement> parseWhileStatement(ASTPointer<ASTString> const& _docString);
-	ASTPointer<WhileStatement> parseDoWhileStatement(ASTPointer<ASTString> const& _docString);
-	ASTPointer<ForStatement> parseForStatement(ASTPointer<ASTString> const& _docString);
-	ASTPointer<EmitStatement> parseEmitStatement(ASTPointer<ASTString> const& docString);
+	ASTPointer<WhileStatement> parseWhileStatement(ASTPointer<ASTString const> const& _docString);
+	ASTPointer<WhileStatement> parseDoWhileStatement(ASTPointer<ASTString const> const& _docString);
+	ASTPointer<ForStatement> parseForStatement(ASTPointer<ASTString const> const& _docString);
+	ASTPointer<EmitStatement> parseEmitStatement(ASTPointer<ASTString const> const& docString);
 	/// A "simple statement" can be a variable declaration statement or an expression statement.
-	ASTPointer<Statement> parseSimpleStatement(ASTPointer<ASTString> const& _docString);
+	ASTPointer<Statement> parseSimpleStatement(ASTPointer<ASTString const> const& _docString);
 	ASTPointer<VariableDeclarationStatement> parseVariableDeclarationStatement(
-		ASTPointer<ASTString> const& _docString,
+		ASTPointer<ASTString const> const& _docString,
 		ASTPointer<TypeName> const& _lookAheadArrayType = ASTPointer<TypeName>()
 	);
 	ASTPointer<ExpressionStatement> parseExpressionStatement(
-		ASTPointer<ASTString> const& _docString,
+		ASTPointer<ASTString const> const& _docString,
 		ASTPointer<Expression> const& _partiallyParsedExpression = ASTPointer<Expression>()
 	);
 	ASTPointer<Expression> parseExpression(
@@ -148,8 +151,8 @@ private:
 	);
 	ASTPointer<Expression> parsePrimaryExpression();
 	std::vector<ASTPointer<Expression>> parseFunctionCallListArguments();
-	std::pair<std::vector<ASTPointer<Expression>>, std::vector<ASTPointer<ASTString>>> parseFunctionCallArguments();
-	std::pair<std::vector<ASTPointer<Expression>>, std::vector<ASTPointer<ASTString>>> parseNamedArguments();
+	std::pair<std::vector<ASTPointer<Expression>>, std::vector<ASTPointer<ASTString const>>> parseFunctionCallArguments();
+	std::pair<std::vector<ASTPointer<Expression>>, std::vector<ASTPointer<ASTString const>>> parseNamedArguments();
 	///@}
 
 	///@{
@@ -198,8 +201,11 @@ private:
 	/// or an empty pointer if an empty @a _pathAndIncides has been supplied.
 	ASTPointer<Expression> expressionFromIndexAccessStructure(IndexAccessedPath const& _pathAndIndices);
 
-	ASTPointer<ASTString> expectIdentifierToken();
-	ASTPointer<ASTString> getLiteralAndAdvance();
+	ASTPointer<ASTString const> expectIdentifierToken();
+	ASTPointer<ASTString const> getLiteralAndAdvance();
+	/// @returns a string with the contents of @a _literal that is shared by all
+	/// names and literals with the same contents in the sources parsed by this parser.
+	ASTPointer<ASTString const> intern(std::string const& _literal);
 	///@}
 
 	/// Creates an empty ParameterList at the current location (used if parameters can be omitted).
@@ -210,6 +216,10 @@ private:
 	langutil::EVMVersion m_evmVersion;
 	/// Counter for the next AST node ID
 	int64_t m_currentNodeID = 0;
+	/// Arena for the nodes of the source unit that is currently parsed.
+	std::shared_ptr<ASTArena> m_arena;
+	/// Strings returned by intern(), keyed by views into themselves.
+	std::unordered_map<std::string_view, ASTPointer<ASTString const>> m_internedStrings;
 };
 
 }
@@ -22,7 +22,9 @@
 
 #include <libsolutil/JSON.h>
 
+#include <libsolutil/Assertions.h>
 #include <libsolutil/CommonIO.h>
+#include <libsolutil/Exceptions.h>
 
 #include <boost/algorithm/string/replace.hpp>
 
@@ -135,4 +137,56 @@ bool jsonParseStrict(string const& _input, Json::Value& _json, string* _errs /*
 	return parse(readerBuilder, _input, _json, _errs);
 }
 
+void JsonObjectStreamWriter::add(vector<string> const& _path, Json::Value const& _value)
+{
+	assertThrow(!m_finished && !_path.empty(), Exception, "");
+	// The objects that contain the previous member are open, the first differing key
+	// determines how many of them have to be closed.
+	size_t common = 0;
+	while (common < m_lastPath.size() && common < _path.size() && m_lastPath[common] == _path[common])
+		++common;
+	assertThrow(
+		common < m_lastPath.size() || m_lastPath.empty(),
+		Exception,
+		"Members have to be added after the objects containing them."
+	);
+	assertThrow(
+		m_lastPath.empty() || (common < _path.size() && m_lastPath[common] < _path[common]),
+		Exception,
+		"Members have to be added in the order of their keys."
+	);
+
+	if (m_lastPath.empty())
+		m_stream << "{";
+	else
+	{
+		for (size_t i = common + 1; i < m_lastPath.size(); ++i)
+			m_stream << "}";
+		m_stream << ",";
+	}
+	for (size_t i = common; i + 1 < _path.size(); ++i)
+		m_stream << jsonCompactPrint(Json::Value(_path[i])) << ":{";
+	m_stream << jsonCompactPrint(Json::Value(_path.back())) << ":" << jsonCompactPrint(_value);
+	m_lastPath = _path;
+}
+
+void JsonObjectStreamWriter::finish()
+{
+	assertThrow(!m_finished, Exception, "");
+	m_finished = true;
+	if (m_lastPath.empty())
+		m_stream << "{";
+	for (size_t i = 0; i < max<size_t>(m_lastPath.size(), 1); ++i)
+		m_stream << "}";
+}
+
+void writeJsonObject(ostream& _stream, function<void(JsonObjectStreamWriter&)> const& _addMembers)
+{
+	stringstream buffer;
+	JsonObjectStreamWriter writer(buffer);
+	_addMembers(writer);
+	writer.finish();
+	_stream << buffer.rdbuf();
+}
+
 } // namespace solidity::util
@@ -25,7 +25,10 @@
 
 #include <json/json.h>
 
+#include <functional>
+#include <ostream>
 #include <string>
+#include <vector>
 
 namespace solidity::util {
 
@@ -45,4 +48,33 @@ std::string jsonCompactPrint(Json::Value const& _input);
 /// \return \c true if the document was successfully parsed, \c false if an error occurred.
 bool jsonParseStrict(std::string const& _input, Json::Value& _json, std::string* _errs = nullptr);
 
+/// Serialises a JSON object to a stream while its members are being produced, so that the
+/// complete object never has to be held in memory. The output is identical to the one of
+/// jsonCompactPrint for the complete object.
+/// Members are identified by the path of keys leading to them and objects along the path
+/// are created implicitly. Since jsoncpp orders object members by key, members have to be
+/// added in this order as well.
+class JsonObjectStreamWriter
+{
+public:
+	explicit JsonObjectStreamWriter(std::ostream& _stream): m_stream(_stream) {}
+
+	/// Writes @a _value as the member at @a _path, which has to be non-empty and to come
+	/// after the path of the previous member.
+	void add(std::vector<std::string> const& _path, Json::Value const& _value);
+	/// Closes all open objects. Has to be called exactly once, after the last member.
+	void finish();
+
+private:
+	std::ostream& m_stream;
+	/// Path of the previously written member.
+	std::vector<std::string> m_lastPath;
+	bool m_finished = false;
+};
+
+/// Serialises the JSON object whose members @a _addMembers adds to the given writer and writes
+/// it to @a _stream once it is complete. If @a _addMembers throws, nothing is written to
+/// @a _stream and the exception is passed on.
+void writeJsonObject(std::ostream& _stream, std::function<void(JsonObjectStreamWriter&)> const& _addMembers);
+
 }
@@ -26,11 +26,36 @@
 
 #include <libsolutil/Assertions.h>
 
-#include <regex>
+#include <algorithm>
+#include <mutex>
+#include <unordered_map>
 
 using namespace std;
 using namespace solidity::util;
 
+namespace
+{
+
+bool isParameterCharacter(char _c)
+{
+	return
+		('a' <= _c && _c <= 'z') ||
+		('A' <= _c && _c <= 'Z') ||
+		('0' <= _c && _c <= '9') ||
+		_c == '_' || _c == '$' || _c == '-';
+}
+
+/// @returns the length of the parameter name starting at @a _position in @a _text.
+size_t parameterLength(string_view _text, size_t _position)
+{
+	size_t end = _position;
+	while (end < _text.size() && isParameterCharacter(_text[end]))
+		++end;
+	return end - _position;
+}
+
+}
+
 Whiskers::Whiskers(string _template):
 	m_template(move(_template))
 {
@@ -68,14 +93,16 @@ Whiskers& Whiskers::operator()(
 
 string Whiskers::render() const
 {
-	return replace(m_template, m_parameters, m_conditions, m_listParameters);
+	shared_ptr<Body const> parsed = parsedTemplate(m_template);
+	string result;
+	render(*parsed, result, m_parameters, nullptr, m_conditions, &m_listParameters);
+	return result;
 }
 
 void Whiskers::checkParameterValid(string const& _parameter) const
 {
-	static regex validParam("^" + paramRegex() + "$");
 	assertThrow(
-		regex_match(_parameter, validParam),
+		!_parameter.empty() && all_of(_parameter.begin(), _parameter.end(), isParameterCharacter),
 		WhiskersError,
 		"Parameter" + _parameter + " contains invalid characters."
 	);
@@ -100,84 +127,202 @@ void Whiskers::checkParameterUnknown(string const& _parameter) const
 	);
 }
 
-namespace
+/// Parsed template text. The segments refer to the text of the template, which has
+/// to be kept alive separately.
+struct Whiskers::Body
 {
-template<class ReplaceCallback>
-string regex_replace(
-	string const& _source,
-	regex const& _pattern,
-	ReplaceCallback _replace,
-	regex_constants::match_flag_type _flags = regex_constants::match_default
-)
+	/// Text of this part of the template, used in error messages.
+	string_view source;
+	vector<Segment> segments;
+};
+
+struct Whiskers::Segment
 {
-	sregex_iterator curMatch(_source.begin(), _source.end(), _pattern, _flags);
-	sregex_iterator matchEnd;
-	string::const_iterator lastMatchedPos(_source.cbegin());
-	string result;
-	while (curMatch != matchEnd)
+	enum class Kind { Text, Tag, List, Condition };
+	Kind kind;
+	/// The text itself for text segments, the name of the parameter otherwise
+	/// (including the leading '+' for conditional string parameters).
+	string_view value;
+	/// Body of a list or the part of a condition used if it is true.
+	Body body;
+	/// Part of a condition used if it is false.
+	Body elseBody;
+};
+
+Whiskers::Body Whiskers::parse(string_view _text)
+{
+	// This matches the elements in the same way as the regular expression
+	//   <(name)>|<#(name)>(.*?)</\2>|<\?(\+?name)>(.*?)(<!\4>(.*?))?</\4>
+	// that was used previously, i.e. without support for nesting elements of the same name.
+	Body result{_text, {}};
+	size_t textStart = 0;
+	for (size_t position = _text.find('<'); position != string_view::npos; position = _text.find('<', position))
 	{
-		result.append(curMatch->prefix().first, curMatch->prefix().second);
-		result.append(_replace(*curMatch));
-		lastMatchedPos = (*curMatch)[0].second;
-		++curMatch;
+		auto const appendText = [&]() {
+			if (position != textStart)
+				result.segments.push_back({Segment::Kind::Text, _text.substr(textStart, position - textStart), {}, {}});
+		};
+		char const kind = position + 1 < _text.size() ? _text[position + 1] : '\0';
+		size_t const nameStart = (kind == '#' || kind == '?') ? position + 2 : position + 1;
+		// Conditional string parameters keep the '+' as part of their name.
+		size_t const plus = (kind == '?' && nameStart < _text.size() && _text[nameStart] == '+') ? 1 : 0;
+		size_t const nameLength = plus + parameterLength(_text, nameStart + plus);
+		size_t const contentStart = nameStart + nameLength + 1;
+		if (nameLength == plus || contentStart > _text.size() || _text[contentStart - 1] != '>')
+		{
+			++position;
+			continue;
+		}
+		string_view const name = _text.substr(nameStart, nameLength);
+
+		if (kind != '#' && kind != '?')
+		{
+			appendText();
+			result.segments.push_back({Segment::Kind::Tag, name, {}, {}});
+			position = textStart = contentStart;
+			continue;
+		}
+
+		string const closingTag = "</" + string(name) + ">";
+		if (kind == '#')
+		{
+			size_t const end = _text.find(closingTag, contentStart);
+			if (end == string_view::npos)
+			{
+				++position;
+				continue;
+			}
+			appendText();
+			result.segments.push_back({
+				Segment::Kind::List,
+				name,
+				parse(_text.substr(contentStart, end - contentStart)),
+				{}
+			});
+			position = textStart = end + closingTag.size();
+			continue;
+		}
+
+		string const elseTag = "<!" + string(name) + ">";
+		size_t end = _text.find(closingTag, contentStart);
+		size_t const elseStart = _text.find(elseTag, contentStart);
+		size_t elseEnd = end;
+		if (elseStart != string_view::npos && elseStart < end)
+		{
+			end = elseStart;
+			elseEnd = _text.find(closingTag, elseStart + elseTag.size());
+		}
+		if (elseEnd == string_view::npos)
+		{
+			++position;
+			continue;
+		}
+		appendText();
+		Body elseBody{string_view{}, {}};
+		if (elseEnd != end)
+			elseBody = parse(_text.substr(elseStart + elseTag.size(), elseEnd - elseStart - elseTag.size()));
+		result.segments.push_back({
+			Segment::Kind::Condition,
+			name,
+			parse(_text.substr(contentStart, end - contentStart)),
+			move(elseBody)
+		});
+		position = textStart = elseEnd + closingTag.size();
 	}
-	result.append(lastMatchedPos, _source.cend());
+	if (textStart != _text.size())
+		result.segments.push_back({Segment::Kind::Text, _text.substr(textStart), {}, {}});
 	return result;
 }
+
+shared_ptr<Whiskers::Body const> Whiskers::parsedTemplate(string const& _template)
+{
+	// Templates are usually constant, but they can also be generated,
+	// so the cache is cleared once it gets too large.
+	size_t constexpr maxCacheSize = 4096;
+	static mutex cacheMutex;
+	static unordered_map<string, shared_ptr<Body const>> cache;
+
+	lock_guard<mutex> lock(cacheMutex);
+	if (auto it = cache.find(_template); it != cache.end())
+		return it->second;
+	if (cache.size() >= maxCacheSize)
+		cache.clear();
+	// The text is stored together with the segments referring to it.
+	auto textAndBody = make_shared<pair<string const, Body>>(_template, Body{});
+	textAndBody->second = parse(textAndBody->first);
+	shared_ptr<Body const> parsed(textAndBody, &textAndBody->second);
+	cache.emplace(_template, parsed);
+	return parsed;
 }
 
-string Whiskers::replace(
-	string const& _template,
+void Whiskers::render(
+	Body const& _body,
+	string& _output,
 	StringMap const& _parameters,
+	StringMap const* _listElement,
 	map<string, bool> const& _conditions,
-	map<string, vector<StringMap>> const& _listParameters
+	StringListMap const* _listParameters
 )
 {
-	static regex listOrTag(
-		"<(" + paramRegex() + ")>|"
-		"<#(" + paramRegex() + ")>((?:.|\\r|\\n)*?)</\\2>|"
-		"<\\?(\\+?" + paramRegex() + ")>((?:.|\\r|\\n)*?)(<!\\4>((?:.|\\r|\\n)*?))?</\\4>"
-	);
-	return regex_replace(_template, listOrTag, [&](match_results<string::const_iterator> _match) -> string
-	{
-		string tagName(_match[1]);
-		string listName(_match[2]);
-		string conditionName(_match[4]);
-		if (!tagName.empty())
+	auto const parameter = [&](string_view _name) -> string const* {
+		// Keys of list elements and other parameters are disjoint, see below.
+		string name{_name};
+		if (_listElement)
+			if (auto it = _listElement->find(name); it != _listElement->end())
+				return &it->second;
+		auto it = _parameters.find(name);
+		return it == _parameters.end() ? nullptr : &it->second;
+	};
+
+	for (Segment const& segment: _body.segments)
+		switch (segment.kind)
 		{
+		case Segment::Kind::Text:
+			_output.append(segment.value);
+			break;
+		case Segment::Kind::Tag:
+		{
+			string const* value = parameter(segment.value);
 			assertThrow(
-				_parameters.count(tagName),
+				value,
 				WhiskersError,
-				"Value for tag " + tagName + " not provided.\n" +
+				"Value for tag " + string(segment.value) + " not provided.\n" +
 				"Template:\n" +
-				_template
+				string(_body.source)
 			);
-			return _parameters.at(tagName);
+			_output.append(*value);
+			break;
 		}
-		else if (!listName.empty())
+		case Segment::Kind::List:
 		{
-			string templ(_match[3]);
+			string const listName{segment.value};
 			assertThrow(
-				_listParameters.count(listName),
+				_listParameters && _listParameters->count(listName),
 				WhiskersError, "List parameter " + listName + " not set."
 			);
-			string replacement;
-			for (auto const& parameters: _listParameters.at(listName))
-				replacement += replace(templ, joinMaps(_parameters, parameters), _conditions);
-			return replacement;
+			// Lists cannot be nested, so there is no list element yet.
+			assertThrow(!_listElement, WhiskersError, "");
+			for (auto const& element: _listParameters->at(listName))
+			{
+				for (auto const& value: element)
+					assertThrow(!_parameters.count(value.first), WhiskersError, "Parameter collision");
+				render(segment.body, _output, _parameters, &element, _conditions, nullptr);
+			}
+			break;
 		}
-		else
+		case Segment::Kind::Condition:
 		{
-			assertThrow(!conditionName.empty(), WhiskersError, "");
+			string const conditionName{segment.value};
 			bool conditionValue = false;
 			if (conditionName[0] == '+')
 			{
 				string tag = conditionName.substr(1);
+				string const* value = parameter(tag);
 				assertThrow(
-					_parameters.count(tag),
+					value,
 					WhiskersError, "Tag " + tag + " used as condition but was not set."
 				);
-				conditionValue = !_parameters.at(tag).empty();
+				conditionValue = !value->empty();
 			}
 			else
 			{
@@ -187,28 +332,15 @@ string Whiskers::replace(
 				);
 				conditionValue = _conditions.at(conditionName);
 			}
-			return replace(
-				conditionValue ? _match[5] : _match[7],
+			render(
+				conditionValue ? segment.body : segment.elseBody,
+				_output,
 				_parameters,
+				_listElement,
 				_conditions,
 				_listParameters
 			);
+			break;
+		}
 		}
-	});
-}
-
-Whiskers::StringMap Whiskers::joinMaps(
-	Whiskers::StringMap const& _a,
-	Whiskers::StringMap const& _b
-)
-{
-	Whiskers::StringMap ret = _a;
-	for (auto const& x: _b)
-		assertThrow(
-			ret.insert(x).second,
-			WhiskersError,
-			"Parameter collision"
-		);
-	return ret;
 }
-
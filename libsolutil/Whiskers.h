@@ -26,8 +26,10 @@
 
 #include <libsolutil/Exceptions.h>
 
-#include <string>
 #include <map>
+#include <memory>
+#include <string>
+#include <string_view>
 #include <vector>
 
 namespace solidity::util
@@ -94,18 +96,25 @@ private:
 	void checkParameterValid(std::string const& _parameter) const;
 	void checkParameterUnknown(std::string const& _parameter) const;
 
-	static std::string replace(
-		std::string const& _template,
+	struct Body;
+	struct Segment;
+
+	/// Parses the template text @a _text into segments referring to it.
+	static Body parse(std::string_view _text);
+	/// @returns the parsed template @a _template, from a cache shared by all instances.
+	static std::shared_ptr<Body const> parsedTemplate(std::string const& _template);
+	/// Appends the rendering of @a _body to @a _output. The parameters of the list element
+	/// @a _listElement (if any) are looked up before @a _parameters.
+	/// Lists are not available inside of lists, so @a _listParameters is null there.
+	static void render(
+		Body const& _body,
+		std::string& _output,
 		StringMap const& _parameters,
+		StringMap const* _listElement,
 		std::map<std::string, bool> const& _conditions,
-		StringListMap const& _listParameters = StringListMap()
+		StringListMap const* _listParameters
 	);
 
-	static std::string paramRegex() { return "[a-zA-Z0-9_$-]+"; }
-
-	/// Joins the two maps throwing an exception if two keys are equal.
-	static StringMap joinMaps(StringMap const& _a, StringMap const& _b);
-
 	std::string m_template;
 	StringMap m_parameters;
 	std::map<std::string, bool> m_conditions;
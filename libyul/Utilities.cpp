@@ -27,11 +27,9 @@
 #include <libsolutil/CommonData.h>
 #include <libsolutil/FixedHash.h>
 
-#include <boost/algorithm/string.hpp>
-
 #include <algorithm>
 #include <iterator>
-#include <sstream>
+#include <string_view>
 #include <vector>
 
 using namespace std;
@@ -43,49 +41,58 @@ string solidity::yul::reindent(string const& _code)
 {
 	int constexpr indentationWidth = 4;
 
-	auto const static countBraces = [](string const& _s) noexcept -> int
+	auto const static countBraces = [](string_view _s) noexcept -> int
 	{
 		auto const i = _s.find("//");
 		auto const e = i == _s.npos ? end(_s) : next(begin(_s), static_cast<ptrdiff_t>(i));
 		auto const opening = count_if(begin(_s), e, [](auto ch) { return ch == '{' || ch == '('; });
 		auto const closing = count_if(begin(_s), e, [](auto ch) { return ch == '}' || ch == ')'; });
-		return opening - closing;
+		return static_cast<int>(opening - closing);
+	};
+	auto const static isSpace = [](char _c) noexcept {
+		return _c == ' ' || _c == '\t' || _c == '\n' || _c == '\v' || _c == '\f' || _c == '\r';
 	};
 
-	vector<string> lines;
-	boost::split(lines, _code, boost::is_any_of("\n"));
-	for (string& line: lines)
-		boost::trim(line);
-
-	// Reduce multiple consecutive empty lines.
-	lines = fold(lines, vector<string>{}, [](auto&& _lines, auto&& _line) {
-		if (!(_line.empty() && !_lines.empty() && _lines.back().empty()))
-			_lines.emplace_back(std::move(_line));
-		return std::move(_lines);
-	});
-
-	stringstream out;
+	// The code is processed line by line in a single pass, since this is used on the whole IR.
+	string out;
+	out.reserve(_code.size() + _code.size() / 2);
 	int depth = 0;
-
-	for (string const& line: lines)
+	bool previousLineEmpty = false;
+	for (size_t lineStart = 0; lineStart <= _code.size();)
 	{
+		size_t lineEnd = _code.find('\n', lineStart);
+		if (lineEnd == string::npos)
+			lineEnd = _code.size();
+		string_view line(_code.data() + lineStart, lineEnd - lineStart);
+		lineStart = lineEnd + 1;
+
+		while (!line.empty() && isSpace(line.front()))
+			line.remove_prefix(1);
+		while (!line.empty() && isSpace(line.back()))
+			line.remove_suffix(1);
+
+		// Reduce multiple consecutive empty lines.
+		if (line.empty() && previousLineEmpty && out.size())
+			continue;
+		previousLineEmpty = line.empty();
+
 		int const diff = countBraces(line);
 		if (diff < 0)
 			depth += diff;
 
 		if (!line.empty())
 		{
-			for (int i = 0; i < depth * indentationWidth; ++i)
-				out << ' ';
-			out << line;
+			if (depth > 0)
+				out.append(static_cast<size_t>(depth * indentationWidth), ' ');
+			out.append(line);
 		}
-		out << '\n';
+		out.push_back('\n');
 
 		if (diff > 0)
 			depth += diff;
 	}
 
-	return out.str();
+	return out;
 }
 
 u256 solidity::yul::valueOfNumberLiteral(Literal const& _literal)
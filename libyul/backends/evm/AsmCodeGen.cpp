@@ -44,14 +44,15 @@ using namespace solidity::yul;
 using namespace solidity::util;
 using namespace solidity::langutil;
 
-EthAssemblyAdapter::EthAssemblyAdapter(evmasm::Assembly& _assembly):
-	m_assembly(_assembly)
+EthAssemblyAdapter::EthAssemblyAdapter(evmasm::Assembly& _assembly, optional<SourceLocation> _locationOverride):
+	m_assembly(_assembly),
+	m_locationOverride(move(_locationOverride))
 {
 }
 
 void EthAssemblyAdapter::setSourceLocation(SourceLocation const& _location)
 {
-	m_assembly.setSourceLocation(_location);
+	m_assembly.setSourceLocation(m_locationOverride ? *m_locationOverride : _location);
 }
 
 int EthAssemblyAdapter::stackHeight() const
@@ -144,7 +145,7 @@ pair<shared_ptr<AbstractAssembly>, AbstractAssembly::SubID> EthAssemblyAdapter::
 {
 	shared_ptr<evmasm::Assembly> assembly{make_shared<evmasm::Assembly>()};
 	auto sub = m_assembly.newSub(assembly);
-	return {make_shared<EthAssemblyAdapter>(*assembly), static_cast<size_t>(sub.data())};
+	return {make_shared<EthAssemblyAdapter>(*assembly, m_locationOverride), static_cast<size_t>(sub.data())};
 }
 
 void EthAssemblyAdapter::appendDataOffset(vector<AbstractAssembly::SubID> const& _subPath)
@@ -227,10 +228,11 @@ void CodeGenerator::assemble(
 	langutil::EVMVersion _evmVersion,
 	ExternalIdentifierAccess const& _identifierAccess,
 	bool _useNamedLabelsForFunctions,
-	bool _optimizeStackAllocation
+	bool _optimizeStackAllocation,
+	optional<SourceLocation> _locationOverride
 )
 {
-	EthAssemblyAdapter assemblyAdapter(_assembly);
+	EthAssemblyAdapter assemblyAdapter(_assembly, move(_locationOverride));
 	BuiltinContext builtinContext;
 	CodeTransform transform(
 		assemblyAdapter,
@@ -25,6 +25,7 @@
 #include <libyul/AsmAnalysis.h>
 #include <liblangutil/SourceLocation.h>
 #include <functional>
+#include <optional>
 
 namespace solidity::evmasm
 {
@@ -39,7 +40,12 @@ struct Block;
 class EthAssemblyAdapter: public AbstractAssembly
 {
 public:
-	explicit EthAssemblyAdapter(evmasm::Assembly& _assembly);
+	/// @param _locationOverride if set, used as source location for all generated items
+	/// instead of the locations of the Yul nodes.
+	explicit EthAssemblyAdapter(
+		evmasm::Assembly& _assembly,
+		std::optional<langutil::SourceLocation> _locationOverride = std::nullopt
+	);
 	void setSourceLocation(langutil::SourceLocation const& _location) override;
 	int stackHeight() const override;
 	void setStackHeight(int height) override;
@@ -72,6 +78,7 @@ private:
 	void appendJumpInstruction(evmasm::Instruction _instruction, JumpType _jumpType);
 
 	evmasm::Assembly& m_assembly;
+	std::optional<langutil::SourceLocation> m_locationOverride;
 	std::map<SubID, u256> m_dataHashBySubId;
 	size_t m_nextDataCounter = std::numeric_limits<size_t>::max() / 2;
 };
@@ -80,6 +87,7 @@ class CodeGenerator
 {
 public:
 	/// Performs code generation and appends generated to _assembly.
+	/// If @a _locationOverride is set, it is used as source location of all generated items.
 	static void assemble(
 		Block const& _parsedData,
 		AsmAnalysisInfo& _analysisInfo,
@@ -87,7 +95,8 @@ public:
 		langutil::EVMVersion _evmVersion,
 		ExternalIdentifierAccess const& _identifierAccess = ExternalIdentifierAccess(),
 		bool _useNamedLabelsForFunctions = false,
-		bool _optimizeStackAllocation = false
+		bool _optimizeStackAllocation = false,
+		std::optional<langutil::SourceLocation> _locationOverride = std::nullopt
 	);
 };
 
@@ -71,9 +71,13 @@
 	#include <unistd.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <string>
 #include <iostream>
 #include <fstream>
+#include <thread>
+#include <unordered_map>
 
 #if !defined(STDERR_FILENO)
 	#define STDERR_FILENO 2
@@ -142,6 +146,7 @@ static string const g_strIPFS = "ipfs";
 static string const g_strLicense = "license";
 static string const g_strLibraries = "libraries";
 static string const g_strLink = "link";
+static string const g_strLinkWorkers = "link-workers";
 static string const g_strMachine = "machine";
 static string const g_strMetadata = "metadata";
 static string const g_strMetadataHash = "metadata-hash";
@@ -172,6 +177,9 @@ static set<string> const g_revertStringsArgs
 };
 
 static string const g_strSignatureHashes = "hashes";
+static string const g_strSMTQueryCache = "smt-query-cache";
+static string const g_strSMTCHCWorkers = "smt-chc-workers";
+static string const g_strSMTPortfolioMode = "smt-portfolio-mode";
 static string const g_strSources = "sources";
 static string const g_strSourceList = "sourceList";
 static string const g_strSrcMap = "srcmap";
@@ -822,6 +830,25 @@ General Information)").c_str(),
 			po::value<string>()->value_name("stage"),
 			"Stop execution after the given compiler stage. Valid options: \"parsing\"."
 		)
+		(
+			g_strSMTQueryCache.c_str(),
+			po::value<string>()->value_name("path"),
+			"Cache the results of the SMT queries of the SMTChecker in the given directory "
+			"and reuse them in later runs."
+		)
+		(
+			g_strSMTCHCWorkers.c_str(),
+			po::value<unsigned>()->value_name("n")->default_value(1),
+			"Number of threads on which the SMTChecker's CHC engine answers its queries. "
+			"Warnings are reported in the same order regardless of this value."
+		)
+		(
+			g_strSMTPortfolioMode.c_str(),
+			po::value<string>()->value_name("sequential,race,paranoid")->default_value("sequential"),
+			"How the SMTChecker's BMC engine distributes its queries among the available solvers: "
+			"one after the other, concurrently taking the first answer, or concurrently comparing all answers. "
+			"The CHC engine uses a single solver."
+		)
 	;
 	desc.add(outputOptions);
 
@@ -835,7 +862,13 @@ General Information)").c_str(),
 		(
 			g_argLink.c_str(),
 			("Switch to linker mode, ignoring all options apart from --" + g_argLibraries + " "
-			"and modify binaries in place.").c_str()
+			"and --" + g_strLinkWorkers + " and modify binaries in place.").c_str()
+		)
+		(
+			g_strLinkWorkers.c_str(),
+			po::value<unsigned>()->value_name("n")->default_value(1),
+			"Number of threads on which the files are linked in linker mode. "
+			"Errors are reported in the same order regardless of this value."
 		)
 		(
 			g_argAssemble.c_str(),
@@ -1054,6 +1087,18 @@ General Information)").c_str(),
 		return false;
 	}
 
+	if (m_args.count(g_strSMTPortfolioMode))
+	{
+		string modeString = m_args[g_strSMTPortfolioMode].as<string>();
+		std::optional<smtutil::SMTPortfolioMode> mode = smtutil::smtPortfolioModeFromString(modeString);
+		if (!mode)
+		{
+			serr() << "Invalid option for --" << g_strSMTPortfolioMode << ": " << modeString << endl;
+			return false;
+		}
+		m_smtPortfolioMode = *mode;
+	}
+
 	if (m_args.count(g_strRevertStrings))
 	{
 		string revertStringsString = m_args[g_strRevertStrings].as<string>();
@@ -1213,7 +1258,8 @@ bool CommandLineInterface::processInput()
 		else
 			input = readFileAsString(jsonFile);
 		StandardCompiler compiler(fileReader);
-		sout() << compiler.compile(std::move(input)) << endl;
+		compiler.compile(input, sout());
+		sout() << endl;
 		return true;
 	}
 
@@ -1400,9 +1446,13 @@ bool CommandLineInterface::processInput()
 			m_compiler->setLibraries(m_libraries);
 		m_compiler->setEVMVersion(m_evmVersion);
 		m_compiler->setRevertStringBehaviour(m_revertStrings);
+		if (m_args.count(g_strSMTQueryCache))
+			m_compiler->setSMTQueryCacheDirectory(m_args[g_strSMTQueryCache].as<string>());
+		m_compiler->setSMTCHCWorkers(m_args[g_strSMTCHCWorkers].as<unsigned>());
+		m_compiler->setSMTPortfolioMode(m_smtPortfolioMode);
 		// TODO: Perhaps we should not compile unless requested
 
-		m_compiler->enableIRGeneration(m_args.count(g_argIR) || m_args.count(g_argIROptimized));
+		m_compiler->enableIRGeneration(m_args.count(g_argIR) || m_args.count(g_argIROptimized), m_args.count(g_argIROptimized));
 		m_compiler->enableEwasmGeneration(m_args.count(g_argEwasm));
 
 		OptimiserSettings settings = m_args.count(g_argOptimize) ? OptimiserSettings::standard() : OptimiserSettings::minimal();
@@ -1678,53 +1728,123 @@ bool CommandLineInterface::actOnInput()
 
 bool CommandLineInterface::link()
 {
-	// Map from how the libraries will be named inside the bytecode to their addresses.
-	map<string, h160> librariesReplacements;
-	int const placeholderSize = 40; // 20 bytes or 40 hex characters
+	// Map from how the libraries will be named inside the bytecode to the hex representation of their addresses.
+	unordered_map<string, string> librariesReplacements;
+	// Map from the placeholders to the hints for the libraries added by the compiler.
+	unordered_map<string, string> libraryHints;
+	size_t const placeholderSize = 40; // 20 bytes or 40 hex characters
 	for (auto const& library: m_libraries)
 	{
 		string const& name = library.first;
+		string const address = toHex(library.second.asBytes());
 		// Library placeholders are 40 hex digits (20 bytes) that start and end with '__'.
 		// This leaves 36 characters for the library identifier. The identifier used to
 		// be just the cropped or '_'-padded library name, but this changed to
 		// the cropped hex representation of the hash of the library name.
 		// We support both ways of linking here.
-		librariesReplacements["__" + evmasm::LinkerObject::libraryPlaceholder(name) + "__"] = library.second;
+		string const placeholder = evmasm::LinkerObject::libraryPlaceholder(name);
+		librariesReplacements["__" + placeholder + "__"] = address;
+		libraryHints[placeholder] = "\n" + libraryPlaceholderHint(name);
 
 		string replacement = "__";
 		for (size_t i = 0; i < placeholderSize - 4; ++i)
 			replacement.push_back(i < name.size() ? name[i] : '_');
 		replacement += "__";
-		librariesReplacements[replacement] = library.second;
+		librariesReplacements[replacement] = address;
 	}
-	for (auto& src: m_sourceCodes)
+
+	struct LinkResult
 	{
-		auto end = src.second.end();
-		for (auto it = src.second.begin(); it != end;)
+		string messages;
+		bool success = true;
+	};
+	vector<pair<string const*, string*>> files;
+	for (auto& [name, content]: m_sourceCodes)
+		files.emplace_back(&name, &content);
+	vector<LinkResult> results(files.size());
+
+	auto linkFile = [&](string const& _name, string& _content) -> LinkResult {
+		LinkResult result;
+		auto const end = _content.end();
+		for (auto it = _content.begin(); it != end;)
 		{
-			while (it != end && *it != '_') ++it;
-			if (it == end) break;
-			if (end - it < placeholderSize)
+			it = find(it, end, '_');
+			if (it == end)
+				break;
+			if (size_t(end - it) < placeholderSize)
 			{
-				serr() << "Error in binary object file " << src.first << " at position " << (end - src.second.begin()) << endl;
-				return false;
+				result.messages +=
+					"Error in binary object file " + _name +
+					" at position " + to_string(end - _content.begin()) + "\n";
+				result.success = false;
+				return result;
 			}
 
-			string name(it, it + placeholderSize);
-			if (librariesReplacements.count(name))
-			{
-				string hexStr(toHex(librariesReplacements.at(name).asBytes()));
-				copy(hexStr.begin(), hexStr.end(), it);
-			}
+			auto replacement = librariesReplacements.find(string(it, it + placeholderSize));
+			if (replacement != librariesReplacements.end())
+				copy(replacement->second.begin(), replacement->second.end(), it);
 			else
-				serr() << "Reference \"" << name << "\" in file \"" << src.first << "\" still unresolved." << endl;
+				result.messages +=
+					"Reference \"" + string(it, it + placeholderSize) + "\" in file \"" + _name + "\" still unresolved.\n";
 			it += placeholderSize;
 		}
+
 		// Remove hints for resolved libraries.
-		for (auto const& library: m_libraries)
-			boost::algorithm::erase_all(src.second, "\n" + libraryPlaceholderHint(library.first));
-		while (!src.second.empty() && *prev(src.second.end()) == '\n')
-			src.second.resize(src.second.size() - 1);
+		if (!libraryHints.empty())
+		{
+			string const hintStart = "\n// $";
+			size_t const placeholderLength = placeholderSize - 4;
+			string withoutHints;
+			size_t copied = 0;
+			for (
+				size_t pos = _content.find(hintStart);
+				pos != string::npos;
+				pos = _content.find(hintStart, pos + 1)
+			)
+			{
+				if (pos < copied)
+					continue;
+				auto hint = libraryHints.find(_content.substr(pos + hintStart.size() - 1, placeholderLength));
+				if (hint == libraryHints.end() || _content.compare(pos, hint->second.size(), hint->second) != 0)
+					continue;
+				withoutHints.append(_content, copied, pos - copied);
+				copied = pos + hint->second.size();
+			}
+			if (copied > 0)
+			{
+				withoutHints.append(_content, copied, string::npos);
+				_content = move(withoutHints);
+			}
+		}
+		while (!_content.empty() && _content.back() == '\n')
+			_content.pop_back();
+		return result;
+	};
+
+	atomic<size_t> nextFile{0};
+	auto worker = [&]() {
+		for (size_t index = nextFile++; index < files.size(); index = nextFile++)
+			results[index] = linkFile(*files[index].first, *files[index].second);
+	};
+	unsigned const workers = m_args[g_strLinkWorkers].as<unsigned>();
+	if (workers <= 1)
+		worker();
+	else
+	{
+		vector<thread> threads;
+		for (size_t i = 0; i < min<size_t>(workers, files.size()); ++i)
+			threads.emplace_back(worker);
+		for (thread& t: threads)
+			t.join();
+	}
+
+	// Report in the order of the files and stop at the first failing file, as if they were
+	// linked one after the other.
+	for (LinkResult const& result: results)
+	{
+		serr() << result.messages;
+		if (!result.success)
+			return false;
 	}
 	return true;
 }
@@ -132,6 +132,8 @@ private:
 	langutil::EVMVersion m_evmVersion;
 	/// How to handle revert strings
 	RevertStrings m_revertStrings = RevertStrings::Default;
+	/// How the SMTChecker distributes its queries among the solvers.
+	smtutil::SMTPortfolioMode m_smtPortfolioMode = smtutil::SMTPortfolioMode::Sequential;
 	/// Chosen hash method for the bytecode metadata.
 	CompilerStack::MetadataHash m_metadataHash = CompilerStack::MetadataHash::IPFS;
 	/// Whether or not to colorize diagnostics output.
@@ -355,6 +355,73 @@ SOLTMPDIR=$(mktemp -d)
 )
 rm -rf "$SOLTMPDIR"
 
+printTask "Testing linking with several workers..."
+SOLTMPDIR=$(mktemp -d)
+(
+    cd "$SOLTMPDIR"
+    set -e
+    cat > x.sol <<'EOF2'
+library L { function f() public pure {} }
+library M { function f() public pure {} }
+contract C { function f() public pure { L.f(); } }
+contract D { function f() public pure { L.f(); M.f(); } }
+contract E { function f() public pure { M.f(); L.f(); } }
+EOF2
+    "$SOLC" --bin -o sequential x.sol 2>/dev/null
+    cp -r sequential parallel
+    cp -r sequential truncated
+    # Only L is given, so the references to M stay unresolved and keep their hints.
+    "$SOLC" --link --libraries x.sol:L:0x90f20564390eAe531E810af625A22f51385Cd222 sequential/*.bin 2> sequential.err
+    "$SOLC" --link --link-workers 4 --libraries x.sol:L:0x90f20564390eAe531E810af625A22f51385Cd222 parallel/*.bin 2> parallel.err
+    diff -r sequential parallel
+    # Errors are reported in the same order.
+    diff <(sed 's/sequential/parallel/g' sequential.err) parallel.err
+    grep -q 'in file "parallel/D.bin" still unresolved' parallel.err
+    grep -q 'in file "parallel/E.bin" still unresolved' parallel.err
+    ! grep -q 'C.bin' parallel.err
+    grep -q -v '[/_]' parallel/C.bin
+    grep -q '// .* -> x.sol:M' parallel/D.bin
+    ! grep -q 'x.sol:L' parallel/D.bin parallel/E.bin
+
+    # A truncated placeholder stops the run before any file is written
+    # and before the errors of later files are reported.
+    echo '6080__' > truncated/B.bin
+    ! "$SOLC" --link --link-workers 4 --libraries x.sol:L:0x90f20564390eAe531E810af625A22f51385Cd222 truncated/*.bin 2> truncated.err
+    grep -q 'Error in binary object file truncated/B.bin' truncated.err
+    ! grep -q 'D.bin\|E.bin' truncated.err
+    grep -q '__' truncated/C.bin
+)
+rm -rf "$SOLTMPDIR"
+
+printTask "Testing SMTChecker workers and query cache..."
+SOLTMPDIR=$(mktemp -d)
+(
+    cd "$SOLTMPDIR"
+    set -e
+    cat > x.sol <<'EOF2'
+pragma experimental SMTChecker;
+contract C {
+    uint x;
+    function f(uint y) public { x = y; assert(x < 10); }
+    function g(uint y) public view { assert(y + x > y); }
+    function h(uint y) public pure { require(y < 100); assert(y * 2 < 200); }
+}
+EOF2
+    "$SOLC" x.sol 2> sequential.err || true
+    "$SOLC" --smt-chc-workers 4 x.sol 2> parallel.err || true
+    grep -q 'Assertion violation happens here' sequential.err
+    # The workers may find different counterexamples, so only the
+    # reported warnings and their locations are compared.
+    diff <(grep -E '^Warning|-->' sequential.err) <(grep -E '^Warning|-->' parallel.err)
+
+    "$SOLC" --smt-query-cache cache x.sol 2> uncached.err || true
+    [ -n "$(ls -A cache)" ]
+    "$SOLC" --smt-query-cache cache x.sol 2> cached.err || true
+    diff sequential.err uncached.err
+    diff uncached.err cached.err
+)
+rm -rf "$SOLTMPDIR"
+
 printTask "Testing overwriting files..."
 SOLTMPDIR=$(mktemp -d)
 (
@@ -0,0 +1,9 @@
+// SPDX-License-Identifier: GPL-3.0
+pragma solidity >=0.0;
+
+contract C {}
+contract D { receive() external payable {} }
+contract T {
+	function f(C c) public pure returns (C) { return c; }
+	function g(D d) public pure returns (D) { return d; }
+}
@@ -273,6 +273,24 @@ BOOST_AUTO_TEST_CASE(subobject_encode_decode)
 	BOOST_CHECK(assembly.decodeSubPath(assembly.encodeSubPath(subPath)) == subPath);
 }
 
+BOOST_AUTO_TEST_CASE(source_mapping)
+{
+	map<string, unsigned> indices = {
+		{ "root.asm", 0 },
+		{ "sub.asm", 1 }
+	};
+	auto root_asm = make_shared<CharStream>("lorem ipsum", "root.asm");
+	auto sub_asm = make_shared<CharStream>("lorem ipsum", "sub.asm");
+
+	AssemblyItems items{Instruction::ADD, Instruction::ADD, Instruction::JUMP};
+	items[0].setLocation({0, 5, root_asm});
+	items[1].setLocation({0, 5, root_asm});
+	items[2].setLocation({2, 3, sub_asm});
+	items[2].setJumpType(AssemblyItem::JumpType::IntoFunction);
+
+	BOOST_CHECK_EQUAL(AssemblyItem::computeSourceMapping(items, indices), "0:5:0:-:0;;2:1:1:i");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -20,10 +20,14 @@
  * Unit tests for the solidity scanner.
  */
 
+#include <liblangutil/CharacterRuns.h>
+#include <liblangutil/Common.h>
 #include <liblangutil/Scanner.h>
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+
 using namespace std;
 using namespace solidity::langutil;
 
@@ -971,6 +975,134 @@ BOOST_AUTO_TEST_CASE(yul_function_with_whitespace)
 	BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
 }
 
+BOOST_AUTO_TEST_CASE(character_runs_match_single_characters)
+{
+	// The runs are skipped in blocks of 16 bytes where possible, so every byte value
+	// is placed at every position of the first three blocks and after different starts.
+	auto isLineBreakCandidate = [](unsigned char _c) { return (0x0a <= _c && _c <= 0x0d) || _c == 0xc2 || _c == 0xe2; };
+	auto isPlainStringCharacter = [](unsigned char _c) { return 0x20 <= _c && _c <= 0x7e && _c != '\\' && _c != '"'; };
+	for (unsigned value = 0; value < 256; ++value)
+		for (size_t stopPosition = 0; stopPosition < 48; ++stopPosition)
+			for (size_t start = 0; start <= min<size_t>(stopPosition, 3); ++start)
+			{
+				auto const c = static_cast<char>(value);
+				auto expectedStop = [&](auto _isRunCharacter) {
+					return _isRunCharacter(static_cast<unsigned char>(c)) ? size_t(48) : stopPosition;
+				};
+
+				string text(48, ' ');
+				text[stopPosition] = c;
+				BOOST_CHECK_EQUAL(skipWhiteSpace(text, start), expectedStop([](unsigned char _c) { return isWhiteSpace(char(_c)); }));
+
+				text.assign(48, 'a');
+				text[stopPosition] = c;
+				BOOST_CHECK_EQUAL(skipIdentifierParts(text, start), expectedStop([](unsigned char _c) { return isIdentifierPart(char(_c)); }));
+				BOOST_CHECK_EQUAL(findLineBreakCandidate(text, start), expectedStop([&](unsigned char _c) { return !isLineBreakCandidate(_c); }));
+				BOOST_CHECK_EQUAL(skipPlainStringCharacters(text, start, '"'), expectedStop(isPlainStringCharacter));
+			}
+}
+
+BOOST_AUTO_TEST_CASE(runs_across_block_boundaries)
+{
+	for (size_t length = 1; length <= 40; ++length)
+	{
+		string const identifier(length, 'x');
+		Scanner scanner(CharStream(string(length, ' ') + identifier + string(length, '\n') + "\"" + identifier + "\"", ""));
+		BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), identifier);
+		BOOST_CHECK_EQUAL(scanner.currentLocation().start, int(length));
+		BOOST_CHECK_EQUAL(scanner.next(), Token::StringLiteral);
+		BOOST_CHECK_EQUAL(scanner.currentLiteral(), identifier);
+		BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(non_ascii_bytes_after_runs)
+{
+	// Bytes with the highest bit set end identifiers, including those that only differ from
+	// letters in that bit, and are only allowed in unicode string literals.
+	for (size_t length = 14; length <= 18; ++length)
+		for (auto const& nonAscii: {"\xC1"s, "\xE1"s, "\xE2\x82\xAC"s})
+		{
+			string const identifier(length, 'a');
+			Scanner scanner(CharStream(identifier + nonAscii, ""));
+			BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+			BOOST_CHECK_EQUAL(scanner.currentLiteral(), identifier);
+			BOOST_CHECK_EQUAL(scanner.next(), Token::Illegal);
+
+			scanner.reset(CharStream("\"" + identifier + nonAscii + "\"", ""));
+			BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Illegal);
+			BOOST_CHECK_EQUAL(scanner.currentError(), ScannerError::IllegalCharacterInString);
+
+			scanner.reset(CharStream("unicode\"" + identifier + nonAscii + "\"", ""));
+			BOOST_CHECK_EQUAL(scanner.currentToken(), Token::UnicodeStringLiteral);
+			BOOST_CHECK_EQUAL(scanner.currentLiteral(), identifier + nonAscii);
+			BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+		}
+}
+
+BOOST_AUTO_TEST_CASE(vertical_tab_and_form_feed_after_runs)
+{
+	// Only space, tab, CR and LF are whitespace.
+	for (auto const& c: {"\v", "\f"})
+		for (size_t length = 14; length <= 18; ++length)
+		{
+			Scanner scanner(CharStream("a" + string(length, ' ') + c + " b", ""));
+			BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+			BOOST_CHECK_EQUAL(scanner.next(), Token::Illegal);
+			BOOST_CHECK_EQUAL(scanner.currentLocation().start, int(length + 1));
+			BOOST_CHECK_EQUAL(scanner.next(), Token::Identifier);
+			BOOST_CHECK_EQUAL(scanner.currentLiteral(), "b");
+			BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+		}
+}
+
+BOOST_AUTO_TEST_CASE(line_breaks_after_long_comments)
+{
+	for (size_t length = 10; length <= 40; ++length)
+	{
+		string const comment(length, 'c');
+		for (auto const& nl: {"\r", "\n", "\r\n"})
+		{
+			Scanner scanner(CharStream("// " + comment + nl + " def", ""));
+			BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+			BOOST_CHECK_EQUAL(scanner.currentLiteral(), "def");
+			BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+
+			scanner.reset(CharStream("/// " + comment + nl + " def", ""));
+			BOOST_CHECK_EQUAL(scanner.currentCommentLiteral(), comment);
+			BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+			BOOST_CHECK_EQUAL(scanner.currentLiteral(), "def");
+		}
+		// Other bytes of the unicode line terminators' encodings do not end the comment.
+		for (auto const& text: {"\xC2\xA0"s, "\xE2\x80\xA7"s, "\xE2\x82\xAC"s})
+		{
+			Scanner scanner(CharStream("/// " + comment + text + comment + "\n def", ""));
+			BOOST_CHECK_EQUAL(scanner.currentCommentLiteral(), comment + text + comment);
+			BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+		}
+		Scanner scanner(CharStream("// " + comment + "\xE2\x80\xA8 def", ""));
+		BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Illegal);
+		BOOST_CHECK_EQUAL(scanner.currentLocation().start, int(length + 3));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(multiline_comment_ending_with_stars)
+{
+	for (size_t stars = 1; stars <= 40; ++stars)
+		for (size_t length = 0; length <= 17; ++length)
+		{
+			Scanner scanner(CharStream("/* " + string(length, 'c') + string(stars, '*') + "/ x", ""));
+			BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+			BOOST_CHECK_EQUAL(scanner.currentLiteral(), "x");
+			BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
+
+			scanner.reset(CharStream("/* " + string(length, 'c') + string(stars, '*') + " x", ""));
+			BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Illegal);
+			BOOST_CHECK_EQUAL(scanner.currentError(), ScannerError::IllegalCommentTerminator);
+		}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -41,6 +41,13 @@ SMTCheckerTest::SMTCheckerTest(string const& _filename): SyntaxTest(_filename, E
 	else
 		BOOST_THROW_EXCEPTION(runtime_error("Invalid SMT solver choice."));
 
+	auto mode = smtutil::smtPortfolioModeFromString(m_reader.stringSetting("SMTPortfolioMode", "sequential"));
+	if (!mode)
+		BOOST_THROW_EXCEPTION(runtime_error("Invalid SMT portfolio mode."));
+	m_portfolioMode = *mode;
+
+	m_chcWorkers = static_cast<unsigned>(m_reader.sizetSetting("CHCWorkers", 1));
+
 	auto available = ModelChecker::availableSolvers();
 	if (!available.z3)
 		m_enabledSolvers.z3 = false;
@@ -55,6 +62,8 @@ TestCase::TestResult SMTCheckerTest::run(ostream& _stream, string const& _linePr
 {
 	setupCompiler();
 	compiler().setSMTSolverChoice(m_enabledSolvers);
+	compiler().setSMTPortfolioMode(m_portfolioMode);
+	compiler().setSMTCHCWorkers(m_chcWorkers);
 	parseAndAnalyze();
 	filterObtainedErrors();
 
@@ -43,6 +43,15 @@ protected:
 	/// The possible options are `all`, `z3`, `cvc4`, `none`,
 	/// where if none is given the default used option is `all`.
 	smtutil::SMTSolverChoice m_enabledSolvers;
+
+	/// This is set via option SMTPortfolioMode in the test.
+	/// The possible options are `sequential`, `race`, `paranoid`,
+	/// where if none is given the default used option is `sequential`.
+	smtutil::SMTPortfolioMode m_portfolioMode;
+
+	/// This is set via option CHCWorkers in the test.
+	/// The default is 1, which answers the CHC queries sequentially.
+	unsigned m_chcWorkers = 1;
 };
 
 }
@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <set>
+#include <sstream>
 
 using namespace std;
 using namespace solidity::evmasm;
@@ -1505,6 +1506,46 @@ BOOST_AUTO_TEST_CASE(stopAfter_ast_output)
 	BOOST_CHECK(result["sources"]["a.sol"]["ast"].isObject());
 }
 
+BOOST_AUTO_TEST_CASE(streamed_output)
+{
+	// Contracts in "a.b" come before the ones in "a" when sorted by "<file>:<name>".
+	char const* valid = R"(
+	{
+		"language": "Solidity",
+		"sources":
+		{
+			"a": { "content": "pragma solidity >=0.0; contract C { function f() public pure {} }" },
+			"a.b": { "content": "pragma solidity >=0.0; contract D { function f() public { uint x; } } contract B {}" }
+		},
+		"settings":
+		{
+			"outputSelection": { "*": { "*": ["abi", "evm.legacyAssembly"], "": ["ast", "legacyAST"] } }
+		}
+	}
+	)";
+	char const* invalid = R"(
+	{
+		"language": "Solidity",
+		"sources":
+		{
+			"a": { "content": "pragma solidity >=0.0; contract C {" }
+		},
+		"settings":
+		{
+			"outputSelection": { "*": { "*": ["abi"], "": ["ast"] } }
+		}
+	}
+	)";
+	for (string input: {valid, invalid, "invalid", "{}"})
+	{
+		solidity::frontend::StandardCompiler compiler;
+		string expectation = compiler.compile(input);
+		stringstream output;
+		compiler.compile(input, output);
+		BOOST_CHECK_EQUAL(output.str(), expectation);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
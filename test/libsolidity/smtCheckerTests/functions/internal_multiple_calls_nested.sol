@@ -0,0 +1,18 @@
+pragma experimental SMTChecker;
+
+contract C {
+	function add(uint a, uint b) internal pure returns (uint) {
+		require(a < 100 && b < 100);
+		return a + b;
+	}
+	function addTwice(uint a, uint b) internal pure returns (uint) {
+		return add(add(a, b), b);
+	}
+	function f(uint a) public pure returns (uint, uint) {
+		uint y = addTwice(a, 1);
+		uint z = addTwice(a, 2);
+		return (z - y, y - z);
+	}
+}
+// ----
+// Warning 3944: (380-385): CHC: Underflow (resulting value less than 0) happens here.
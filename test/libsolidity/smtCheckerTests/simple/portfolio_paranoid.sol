@@ -0,0 +1,17 @@
+pragma experimental SMTChecker;
+
+contract C
+{
+	function f(uint x, uint y) public pure {
+		require(x < 100 && y < 100);
+		uint z = x + y;
+		// Holds, so the answers of all solvers are compared.
+		assert(z < 200);
+		// Fails.
+		assert(z < 150);
+	}
+}
+// ====
+// SMTPortfolioMode: paranoid
+// ----
+// Warning 6328: (226-241): CHC: Assertion violation happens here.
@@ -21,11 +21,14 @@
  */
 
 #include <libsolutil/JSON.h>
+#include <libsolutil/Exceptions.h>
 
 #include <test/Common.h>
 
 #include <boost/test/unit_test.hpp>
 
+#include <sstream>
+
 using namespace std;
 
 namespace solidity::util::test
@@ -70,6 +73,60 @@ BOOST_AUTO_TEST_CASE(json_compact_print)
 	BOOST_CHECK("{\"1\":1,\"2\":\"2\",\"3\":{\"3.1\":\"3.1\",\"3.2\":2}}" == jsonCompactPrint(json));
 }
 
+BOOST_AUTO_TEST_CASE(json_object_stream_writer)
+{
+	Json::Value json;
+	Json::Value array(Json::arrayValue);
+	array.append(1);
+	array.append("\"");
+	json["a"]["b"]["c"] = array;
+	json["a"]["b"]["d"] = "d";
+	json["a"]["e"] = Json::objectValue;
+	json["f"] = 2;
+
+	stringstream stream;
+	JsonObjectStreamWriter writer(stream);
+	writer.add({"a", "b", "c"}, array);
+	writer.add({"a", "b", "d"}, "d");
+	writer.add({"a", "e"}, Json::objectValue);
+	writer.add({"f"}, 2);
+	writer.finish();
+	BOOST_CHECK_EQUAL(stream.str(), jsonCompactPrint(json));
+
+	// Out of order.
+	stringstream unused;
+	JsonObjectStreamWriter invalid(unused);
+	invalid.add({"b"}, 1);
+	BOOST_CHECK_THROW(invalid.add({"a"}, 1), Exception);
+	BOOST_CHECK_THROW(invalid.add({"b", "c"}, 1), Exception);
+
+	stringstream empty;
+	JsonObjectStreamWriter emptyWriter(empty);
+	emptyWriter.finish();
+	BOOST_CHECK_EQUAL(empty.str(), "{}");
+}
+
+BOOST_AUTO_TEST_CASE(write_json_object)
+{
+	stringstream stream;
+	writeJsonObject(stream, [](JsonObjectStreamWriter& _writer) {
+		_writer.add({"a", "b"}, 1);
+		_writer.add({"c"}, "d");
+	});
+	BOOST_CHECK_EQUAL(stream.str(), "{\"a\":{\"b\":1},\"c\":\"d\"}");
+
+	// Nothing is written if an error occurs after some of the members were added.
+	stringstream incomplete;
+	BOOST_CHECK_THROW(
+		writeJsonObject(incomplete, [](JsonObjectStreamWriter& _writer) {
+			_writer.add({"a", "b"}, 1);
+			BOOST_THROW_EXCEPTION(Exception());
+		}),
+		Exception
+	);
+	BOOST_CHECK_EQUAL(incomplete.str(), "");
+}
+
 BOOST_AUTO_TEST_CASE(parse_json_strict)
 {
 	Json::Value json;